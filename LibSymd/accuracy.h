@@ -0,0 +1,24 @@
+#pragma once
+#include "internal/platform.h"
+
+
+namespace symd
+{
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
+    /// <summary>
+    /// Accuracy tiers of transcendental kernels, passed as first template argument, e.g. kernel::exp<symd::precise>(x).
+    /// Tiers select polynomial degree and range reduction, bounds are documented on each kernel.
+    /// </summary>
+
+    // Lowest degree polynomials, about 1e-3 relative error.
+    struct fast {};
+
+    // Default. Balanced speed and accuracy, about 1e-5 error.
+    struct standard {};
+
+    // Careful range reduction and higher degree polynomials, few ULP error.
+    struct precise {};
+    } // SYMD_ISA_NAMESPACE
+}
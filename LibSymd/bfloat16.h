@@ -1,8 +1,13 @@
 #pragma once
+#include <cmath>
+#include "internal/platform.h"
 
 
 namespace symd
 {
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
     struct bfloat16
     {
     private:
@@ -52,29 +57,30 @@ namespace symd
         }
     };
 
-    bfloat16& operator+=(bfloat16& first, const bfloat16& sec)
+    inline bfloat16& operator+=(bfloat16& first, const bfloat16& sec)
     {
         first = first + sec;
         return first;
     }
 
-    bfloat16& operator-=(bfloat16& first, const bfloat16& sec)
+    inline bfloat16& operator-=(bfloat16& first, const bfloat16& sec)
     {
         first = first - sec;
         return first;
     }
 
-    bfloat16& operator*=(bfloat16& first, const bfloat16& sec)
+    inline bfloat16& operator*=(bfloat16& first, const bfloat16& sec)
     {
         first = first * sec;
         return first;
     }
 
-    bfloat16& operator/=(bfloat16& first, const bfloat16& sec)
+    inline bfloat16& operator/=(bfloat16& first, const bfloat16& sec)
     {
         first = first * sec;
         return first;
     }
+    } // SYMD_ISA_NAMESPACE
 }
 
 namespace std
@@ -0,0 +1,109 @@
+#pragma once
+#include "internal/symd_register.h"
+
+#if defined(SYMD_SSE) && defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+#endif
+
+
+namespace symd
+{
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
+    /// <summary>
+    /// Instruction sets Symd has register implementation for. There is no 128 bit SSE4.2 tier on x64, Symd registers
+    /// are built on 256 bit AVX2 registers, so CPUs without AVX2 are not supported.
+    /// </summary>
+    enum class Isa
+    {
+        avx2,       // 8 elements per register. Default on x64.
+        avx512,     // 16 elements per register. Requires SYMD_USE_AVX512 and AVX-512 F, BW, DQ and VL.
+        neon        // 4 elements per register. ARM.
+    };
+    } // SYMD_ISA_NAMESPACE
+}
+
+namespace symd::__internal__
+{
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
+    inline Isa detectIsa()
+    {
+#if defined(SYMD_SSE) && defined(_MSC_VER) && !defined(__clang__)
+        int regs[4];
+        __cpuidex(regs, 7, 0);
+
+        const int ebx = regs[1];
+        const bool cpuHasAvx512 = (ebx & (1 << 16)) && (ebx & (1 << 17)) && (ebx & (1 << 30)) && (ebx & (1 << 31));
+
+        // OS has to save opmask and upper halves of zmm registers on context switch.
+        const bool osHasAvx512 = (_xgetbv(0) & 0xE6) == 0xE6;
+
+        return cpuHasAvx512 && osHasAvx512 ? Isa::avx512 : Isa::avx2;
+#elif defined(SYMD_SSE)
+        __builtin_cpu_init();
+
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+            __builtin_cpu_supports("avx512dq") && __builtin_cpu_supports("avx512vl"))
+        {
+            return Isa::avx512;
+        }
+
+        return Isa::avx2;
+#else
+        return Isa::neon;
+#endif
+    }
+    } // SYMD_ISA_NAMESPACE
+}
+
+namespace symd
+{
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
+    /// <summary>
+    /// Best instruction set supported by CPU this process runs on. Detected on first call and cached.
+    /// </summary>
+    inline Isa detected_isa()
+    {
+        static const Isa isa = __internal__::detectIsa();
+        return isa;
+    }
+
+    /// <summary>
+    /// Instruction set this translation unit is compiled for.
+    /// </summary>
+    constexpr Isa compiled_isa()
+    {
+#if defined SYMD_AVX512
+        return Isa::avx512;
+#elif defined SYMD_SSE
+        return Isa::avx2;
+#else
+        return Isa::neon;
+#endif
+    }
+
+    /// <summary>
+    /// Picks implementation for best instruction set supported by CPU.
+    ///
+    /// Same kernel source is compiled once per instruction set, with its functions placed in SYMD_ISA_NAMESPACE:
+    ///     kernels.cpp compiled with -mavx2 -mfma                                 -> isa_avx2::process
+    ///     kernels.cpp compiled with -mavx512f -mavx512bw -mavx512dq -mavx512vl
+    ///                              -DSYMD_USE_AVX512                             -> isa_avx512::process
+    ///
+    /// Store result in static variable so detection and selection happen only once:
+    ///     static const auto process = symd::select_by_isa(isa_avx2::process, isa_avx512::process);
+    /// </summary>
+    /// <param name="avx2Impl">Implementation used when AVX-512 is not available.</param>
+    /// <param name="avx512Impl">Implementation used on CPUs with AVX-512.</param>
+    template <typename Func>
+    Func select_by_isa(Func avx2Impl, Func avx512Impl)
+    {
+        return detected_isa() == Isa::avx512 ? avx512Impl : avx2Impl;
+    }
+    } // SYMD_ISA_NAMESPACE
+}
@@ -2,11 +2,16 @@
 #include <array>
 #include <vector>
 #include <cassert>
+#include <initializer_list>
 #include <algorithm>
+#include "internal/platform.h"
 
 
 namespace symd
 {
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
     /// <summary>
     /// Struct representing shape of input data.
     /// </summary>
@@ -14,7 +19,8 @@ namespace symd
     {
         static constexpr int MAX_DIMS = 5;
 
-        std::array<int64_t, MAX_DIMS> _dims;
+        // Value initialized, so unused trailing dimensions compare and copy as zeros
+        std::array<int64_t, MAX_DIMS> _dims{};
         int _ndims;
 
     public:
@@ -36,6 +42,16 @@ namespace symd
                 _dims[i] = dims[i];
         }
 
+        // Braced shapes like Dimensions({ 2, 2 }) are built without temporary vector (no heap allocation).
+        Dimensions(std::initializer_list<int64_t> dims)
+        {
+            assert(dims.size() <= MAX_DIMS);
+            assert(dims.size() > 0);
+
+            _ndims = dims.size();
+            std::copy(dims.begin(), dims.end(), _dims.begin());
+        }
+
         int64_t operator[](int ind) const
         {
             if (ind < 0)
@@ -128,6 +144,23 @@ namespace symd
             return result;
         }
 
+        /// Returns true if elements with given pitch are densely packed (pitch is native pitch).
+        /// Dimensions of size one are ignored since their pitch is never used.
+        bool is_native_pitch(const Dimensions& pitch) const
+        {
+            assert(this->_ndims == pitch._ndims);
+
+            auto nativePitch = this->native_pitch();
+
+            for (int i = 0; i < _ndims; i++)
+            {
+                if (_dims[i] > 1 && pitch._dims[i] != nativePitch._dims[i])
+                    return false;
+            }
+
+            return true;
+        }
+
         Dimensions zeros_like() const
         {
             Dimensions result;
@@ -297,4 +330,5 @@ namespace symd
             return res;
         }
     };
+    } // SYMD_ISA_NAMESPACE
 }
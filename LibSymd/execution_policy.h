@@ -0,0 +1,136 @@
+#pragma once
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include "internal/platform.h"
+
+
+namespace symd
+{
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
+    /// <summary>
+    /// Specifies how symd::map distributes regions over threads. Map throws std::invalid_argument when requested
+    /// backend is not compiled in or does not support the policy.
+    /// </summary>
+    enum class Backend
+    {
+        automatic,      // TBB if SYMD_USE_TBB is defined, std::execution on Windows, built-in thread pool otherwise
+                        // (and whenever other backend can not honour num_threads or pin_threads).
+        single_core,    // No splitting, runs inline on calling thread.
+        thread_pool,    // Built-in work-stealing thread pool.
+        tbb,            // Intel TBB. Requires SYMD_USE_TBB.
+        std_execution   // std::execution::par_unseq. Requires Windows or SYMD_USE_STD_EXECUTION, num_threads must be 0.
+    };
+
+    /// <summary>
+    /// Configures parallel execution of symd::map. Pass it as first argument to symd::map.
+    /// </summary>
+    struct execution_policy
+    {
+        Backend backend = Backend::automatic;
+
+        // Number of threads working on map. 0 means one thread per hardware core.
+        int num_threads = 0;
+
+        // Regions are split until they have less elements than this. Bigger value means less parallel overhead.
+        // Must be at least 1, with_min_region_size and map throw std::invalid_argument otherwise.
+        int64_t min_region_size = 100000;
+
+        // Pins worker threads to cores. Supported for built-in thread pool on Linux. Pinned pools of different
+        // configurations get different cores while there are enough of them.
+        bool pin_threads = false;
+
+        // Maps with stencil inputs are split in tiles sized by L1 and L2 cache instead of by min_region_size. Off by
+        // default, tiles were slower than plain split for 5x5 stencil on 4K frames (see map tests).
+        bool cache_blocking = false;
+
+        // Inputs are prefetched this many bytes ahead of current vector (all rows of stencil window). 0 disables
+        // prefetching. Gain depends on hardware: it helps only where hardware prefetcher does not follow all input
+        // streams. On recent x86 cores YUV and 5x5 stencil benchmarks (map tests) ran the same, so measure first.
+        int64_t prefetch_distance = 0;
+
+        // Number of vectors processed per iteration of inner loop. Only 1, 2 and 4 are accepted, with_unroll and
+        // map throw std::invalid_argument for other values. Independent vectors in flight may hide latency of long
+        // dependency chains, but gain depends on core and kernel (exp and log showed none consistently).
+        int unroll = 1;
+
+        execution_policy with_backend(Backend newBackend) const
+        {
+            execution_policy res = *this;
+            res.backend = newBackend;
+            return res;
+        }
+
+        execution_policy with_num_threads(int newNumThreads) const
+        {
+            execution_policy res = *this;
+            res.num_threads = newNumThreads;
+            return res;
+        }
+
+        execution_policy with_min_region_size(int64_t newMinRegionSize) const
+        {
+            check_min_region_size(newMinRegionSize);
+
+            execution_policy res = *this;
+            res.min_region_size = newMinRegionSize;
+            return res;
+        }
+
+        execution_policy with_pinned_threads(bool pin = true) const
+        {
+            execution_policy res = *this;
+            res.pin_threads = pin;
+            return res;
+        }
+
+        execution_policy with_cache_blocking(bool enable = true) const
+        {
+            execution_policy res = *this;
+            res.cache_blocking = enable;
+            return res;
+        }
+
+        execution_policy with_prefetch_distance(int64_t newPrefetchDistance) const
+        {
+            execution_policy res = *this;
+            res.prefetch_distance = newPrefetchDistance;
+            return res;
+        }
+
+        execution_policy with_unroll(int newUnroll) const
+        {
+            check_unroll(newUnroll);
+
+            execution_policy res = *this;
+            res.unroll = newUnroll;
+            return res;
+        }
+
+        static void check_unroll(int value)
+        {
+            if (value != 1 && value != 2 && value != 4)
+                throw std::invalid_argument("Unroll must be 1, 2 or 4.");
+        }
+
+        static void check_min_region_size(int64_t value)
+        {
+            if (value < 1)
+                throw std::invalid_argument("Min region size must be at least 1.");
+        }
+    };
+
+    /// <summary>
+    /// Runs map on calling thread only. Good choice for small inputs.
+    /// </summary>
+    inline execution_policy single_core_policy()
+    {
+        return execution_policy().with_backend(Backend::single_core);
+    }
+
+    template <typename T>
+    constexpr bool is_execution_policy_v = std::is_same_v<std::decay_t<T>, execution_policy>;
+    } // SYMD_ISA_NAMESPACE
+}
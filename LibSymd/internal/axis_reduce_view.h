@@ -0,0 +1,238 @@
+#pragma once
+#include "symd_register.h"
+#include "../dimensions.h"
+#include "data_view.h"
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+
+namespace symd::views
+{
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
+    /// <summary>
+    /// View used for reduction along some axes. Perform symd::map to this view in order to perform reductions.
+    /// Result is written to output view which has shape of input with reduced axes of size 1, for example per row
+    /// sums of (height, width) input go to output of shape (height, 1) and column maxima to output of shape (1, width).
+    /// </summary>
+    template <typename T, typename ReduceOperation, typename OutView>
+    struct axis_reduce_view
+    {
+        OutView _output;
+
+        // Bit i is set if axis i is reduced.
+        uint32_t _reducedAxes;
+
+    public:
+        const Dimensions _shape;
+        const T _startValue;
+        const ReduceOperation _reduceOperation;
+
+        /// <summary>
+        /// Constructs axis_reduce_view and fills output with startValue.
+        /// </summary>
+        /// <param name="shape">Shape of input view you want to perform reduction on.</param>
+        /// <param name="axes">Axes which are reduced. At least one axis has to be kept.</param>
+        /// <param name="output">View with accessible memory where result is written.</param>
+        /// <param name="startValue">Value for initializing operation / neutral element for operation. Eg 0 for addition or 1 for multiplication.</param>
+        /// <param name="reduceOperation">Input operation lambda function.</param>
+        axis_reduce_view(const Dimensions& shape, const std::vector<int>& axes, const OutView& output, const T& startValue, const ReduceOperation& reduceOperation)
+            : _output(output)
+            , _reducedAxes(0)
+            , _shape(shape)
+            , _startValue(startValue)
+            , _reduceOperation(reduceOperation)
+        {
+            for (int axis : axes)
+            {
+                assert(axis >= 0 && axis < shape.num_dims());
+                _reducedAxes |= 1u << axis;
+            }
+
+            assert(_reducedAxes != (1u << shape.num_dims()) - 1 && "Use reduce_view to reduce all axes.");
+
+            auto outShape = outputShape();
+            assert(__internal__::getShape(_output).num_dims() == shape.num_dims());
+
+            for (int i = 0; i < shape.num_dims(); i++)
+                assert(__internal__::getShape(_output)[i] == outShape[i]);
+
+            fill(outShape.zeros_like(), 0, outShape);
+        }
+
+        /// <summary>
+        /// True if axis is reduced.
+        /// </summary>
+        bool isReduced(int axis) const
+        {
+            return (_reducedAxes >> axis) & 1u;
+        }
+
+        /// <summary>
+        /// Shape of output: shape of input with reduced axes of size 1.
+        /// </summary>
+        Dimensions outputShape() const
+        {
+            auto res = _shape;
+
+            for (int i = 0; i < _shape.num_dims(); i++)
+                if (isReduced(i))
+                    res.set_ith_dim(i, 1);
+
+            return res;
+        }
+
+        /// <summary>
+        /// Output coordinates of input element at coords.
+        /// </summary>
+        Dimensions outputCoords(Dimensions coords) const
+        {
+            for (int i = 0; i < coords.num_dims(); i++)
+                if (isReduced(i))
+                    coords.set_ith_dim(i, 0);
+
+            return coords;
+        }
+
+    private:
+        void fill(Dimensions coords, int dim, const Dimensions& outShape)
+        {
+            for (int64_t i = 0; i < outShape[dim]; i++)
+            {
+                coords.set_ith_dim(dim, i);
+
+                if (dim + 1 < outShape.num_dims())
+                    fill(coords, dim + 1, outShape);
+                else
+                    *__internal__::getDataPtr(_output, coords) = _startValue;
+            }
+        }
+    };
+    } // SYMD_ISA_NAMESPACE
+}
+
+
+namespace symd::__internal__
+{
+    template <typename T, typename ReduceOperation, typename OutView>
+    Dimensions getShape(const views::axis_reduce_view<T, ReduceOperation, OutView>& reductor)
+    {
+        return reductor._shape;
+    }
+
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
+    /// <summary>
+    /// Row cursor of axis_reduce_view. When last axis is kept, input row accumulates to output row with vector operations.
+    /// When last axis is reduced, vectors accumulate in register which is reduced horizontally to single output element
+    /// at the end of the row (finishRow).
+    /// </summary>
+    template <typename T, typename ReduceOperation>
+    struct AxisReduceRowCursor
+    {
+        static constexpr bool supports_partial = true;
+
+        const ReduceOperation* _reduceOperation;
+        T* _out;
+        int64_t _stride;
+        bool _lastReduced;
+        T _startValue;
+        SymdRegister<T> _acc;
+
+        void save(int64_t i, const T& element)
+        {
+            T* out = _lastReduced ? _out : _out + i * _stride;
+            *out = (*_reduceOperation)(*out, element);
+        }
+
+        void saveVec(int64_t i, const SymdRegister<T>& element)
+        {
+            if (_lastReduced)
+            {
+                _acc = (*_reduceOperation)(_acc, element);
+            }
+            else
+            {
+                assert(_stride == 1);
+                (*_reduceOperation)(SymdRegister<T>(_out + i), element).store(_out + i);
+            }
+        }
+
+        void saveVecPartial(int64_t i, const SymdRegister<T>& element, int count)
+        {
+            if (_lastReduced)
+            {
+                auto mask = SymdRegister<T>::first_lanes_mask(count);
+                _acc = (*_reduceOperation)(_acc, mask.blend(element, SymdRegister<T>(_startValue)));
+            }
+            else
+            {
+                assert(_stride == 1);
+                (*_reduceOperation)(SymdRegister<T>(_out + i, count), element).store(_out + i, count);
+            }
+        }
+
+        void finishRow()
+        {
+            if (!_lastReduced)
+                return;
+
+            T res = *_out;
+
+            for (int i = 0; i < SYMD_LEN; i++)
+                res = (*_reduceOperation)(res, _acc[i]);
+
+            *_out = res;
+        }
+    };
+
+    template <typename T, typename ReduceOperation, typename OutView>
+    auto rowCursor(views::axis_reduce_view<T, ReduceOperation, OutView>& reductor, const Dimensions& rowCoords)
+    {
+        int lastDim = rowCoords.num_dims() - 1;
+
+        return AxisReduceRowCursor<T, ReduceOperation>{
+            &reductor._reduceOperation,
+            getDataPtr(reductor._output, reductor.outputCoords(rowCoords)),
+            getPitch(reductor._output)[-1],
+            reductor.isReduced(lastDim),
+            reductor._startValue,
+            SymdRegister<T>(reductor._startValue) };
+    }
+
+    /// <summary>
+    /// Views other than axis reductions can be split along any axis.
+    /// </summary>
+    template <typename View>
+    uint32_t splitMask(const View&)
+    {
+        return ~0u;
+    }
+
+    /// <summary>
+    /// Regions of parallel map must not split reduced axes, otherwise two regions would accumulate to same output.
+    /// </summary>
+    template <typename T, typename ReduceOperation, typename OutView>
+    uint32_t splitMask(const views::axis_reduce_view<T, ReduceOperation, OutView>& reductor)
+    {
+        return ~reductor._reducedAxes;
+    }
+
+    /// <summary>
+    /// Called by map_row after last element of row is saved. Only cursors which buffer results need it.
+    /// </summary>
+    template <typename Cursor>
+    void finishRow(Cursor&)
+    {
+    }
+
+    template <typename T, typename ReduceOperation>
+    void finishRow(AxisReduceRowCursor<T, ReduceOperation>& cursor)
+    {
+        cursor.finishRow();
+    }
+    } // SYMD_ISA_NAMESPACE
+}
@@ -5,11 +5,16 @@
 #include "std_vector_view.h"
 #include "std_array_view.h"
 #include "data_view.h"
+#include "tensor.h"
 #include "reduce_view.h"
+#include "axis_reduce_view.h"
 
 
 namespace symd::__internal__
 {
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
     template <typename View>
     auto fetchData(const View& view, const Dimensions& coords)
     {
@@ -44,4 +49,5 @@ namespace symd::__internal__
     {
         return getShape(input).native_border();
     }
+    } // SYMD_ISA_NAMESPACE
 }
@@ -0,0 +1,190 @@
+#pragma once
+#include <cassert>
+#include <type_traits>
+#include "basic_views.h"
+#include "row_cursor.h"
+#include "../dimensions.h"
+
+
+namespace symd::__internal__
+{
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
+    /// <summary>
+    /// Read only view which repeats underlying view to larger shape. Dimensions of size 1 are repeated, missing
+    /// leading dimensions are added (same rules as NumPy broadcasting).
+    /// </summary>
+    template <typename View>
+    struct BroadcastView
+    {
+        View _underlyingView;
+        Dimensions _shape;
+
+        BroadcastView(View&& view, const Dimensions& shape)
+            : _underlyingView(std::forward<View>(view))
+            , _shape(shape)
+        {
+            auto underlyingShape = getShape(_underlyingView);
+            assert(underlyingShape.num_dims() <= shape.num_dims());
+
+            for (int i = 1; i <= underlyingShape.num_dims(); i++)
+                assert(underlyingShape[-i] == 1 || underlyingShape[-i] == shape[-i]);
+        }
+
+        /// <summary>
+        /// Coordinates in underlying view of element at coords. Broadcast dimensions always read element 0.
+        /// </summary>
+        Dimensions underlyingCoords(const Dimensions& coords) const
+        {
+            auto underlyingShape = getShape(_underlyingView);
+            auto result = underlyingShape.zeros_like();
+            int offset = coords.num_dims() - underlyingShape.num_dims();
+
+            for (int i = 0; i < underlyingShape.num_dims(); i++)
+                result.set_ith_dim(i, underlyingShape[i] == 1 ? 0 : coords[i + offset]);
+
+            return result;
+        }
+
+        bool broadcastsLastDim() const
+        {
+            auto underlyingShape = getShape(_underlyingView);
+            return underlyingShape[-1] == 1 && _shape[-1] > 1;
+        }
+    };
+    } // SYMD_ISA_NAMESPACE
+
+    template <typename View>
+    Dimensions getShape(const BroadcastView<View>& bv)
+    {
+        return bv._shape;
+    }
+
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
+    template <typename View>
+    auto fetchData(const BroadcastView<View>& bv, const Dimensions& coords)
+    {
+        return fetchData(bv._underlyingView, bv.underlyingCoords(coords));
+    }
+
+    /// <summary>
+    /// Iterates over one row of broadcast view. Row of underlying view is read with stride 0 when last dimension is
+    /// broadcast, in which case vector fetch returns register with same value in all lanes.
+    /// </summary>
+    template <typename T>
+    struct BroadcastRowCursor
+    {
+        static constexpr bool supports_partial = true;
+        static constexpr bool handles_borders = true;
+
+        using DataType = std::remove_const_t<T>;
+
+        T* _ptr;
+        int64_t _stride;
+
+        auto fetch(int64_t i) const
+        {
+            return _ptr[i * _stride];
+        }
+
+        auto fetchVec(int64_t i) const
+        {
+            if (_stride == 0)
+                return SymdRegister<DataType>(*_ptr);
+
+            assert(_stride == 1);
+            return SymdRegister<DataType>(_ptr + i);
+        }
+
+        // Lanes after count are not used, splat can fill all of them.
+        auto fetchVecPartial(int64_t i, int count) const
+        {
+            if (_stride == 0)
+                return SymdRegister<DataType>(*_ptr);
+
+            assert(_stride == 1);
+            return SymdRegister<DataType>(_ptr + i, count);
+        }
+
+        auto fetchVecBorder(int64_t i) const
+        {
+            return fetchVec(i);
+        }
+
+        auto fetchVecBorderPartial(int64_t i, int count) const
+        {
+            return fetchVecPartial(i, count);
+        }
+
+        // Broadcast last dimension reads only one element, it stays in cache.
+        void prefetch(int64_t i, int64_t distance) const
+        {
+            if (_stride != 0)
+                prefetch_memory((const char*)(_ptr + i * _stride) + distance);
+        }
+
+        auto fetchFull(int64_t i) const
+        {
+            if (_stride == 0)
+                return FullWidthRegister<DataType>(*_ptr);
+
+            assert(_stride == 1);
+            return FullWidthRegister<DataType>(_ptr + i);
+        }
+
+        auto fetchFullPartial(int64_t i, int count) const
+        {
+            if (_stride == 0)
+                return FullWidthRegister<DataType>(*_ptr);
+
+            assert(_stride == 1);
+            return FullWidthRegister<DataType>(_ptr + i, count);
+        }
+    };
+
+    template <typename T>
+    constexpr bool isByteCursor<BroadcastRowCursor<T>> = std::is_same_v<std::remove_const_t<T>, unsigned char>;
+
+    /// <summary>
+    /// Broadcast view is input only, row cursor reads underlying memory directly.
+    /// </summary>
+    template <typename View>
+    auto rowCursor(const BroadcastView<View>& bv, const Dimensions& rowCoords)
+    {
+        static_assert(HasDataPtr<const std::remove_reference_t<View>>::value, "Broadcast view requires view with underlying memory.");
+
+        auto* ptr = getDataPtr(static_cast<const std::remove_reference_t<View>&>(bv._underlyingView), bv.underlyingCoords(rowCoords));
+        int64_t stride = bv.broadcastsLastDim() ? 0 : getPitch(bv._underlyingView)[-1];
+
+        return BroadcastRowCursor<std::remove_reference_t<decltype(*ptr)>>{ ptr, stride };
+    }
+
+    template <typename View>
+    auto rowCursor(BroadcastView<View>& bv, const Dimensions& rowCoords)
+    {
+        return rowCursor(static_cast<const BroadcastView<View>&>(bv), rowCoords);
+    }
+    } // SYMD_ISA_NAMESPACE
+}
+
+namespace symd::views
+{
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
+    /// <summary>
+    /// Repeats input view to shape, so inputs of different shapes can be used in same map. Dimensions of size 1 are
+    /// repeated and missing leading dimensions are added, e.g. bias of shape { C } can be added to tensor { N, C }.
+    /// </summary>
+    /// <param name="view">Underlying view. Every dimension must be 1 or equal to corresponding dimension of shape.</param>
+    /// <param name="shape">Shape of resulting view.</param>
+    template <typename View>
+    auto broadcast(View&& view, const Dimensions& shape)
+    {
+        return __internal__::BroadcastView<View>(std::forward<View>(view), shape);
+    }
+    } // SYMD_ISA_NAMESPACE
+}
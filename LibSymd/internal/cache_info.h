@@ -0,0 +1,48 @@
+#pragma once
+#include <cstdint>
+#include "platform.h"
+
+#ifdef __linux__
+    #include <unistd.h>
+#endif
+
+
+namespace symd::__internal__
+{
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
+    // Used when cache size can't be queried. Smallest sizes found on AVX2 capable CPUs.
+    constexpr int64_t DEFAULT_L1_CACHE_SIZE = 32 * 1024;
+    constexpr int64_t DEFAULT_L2_CACHE_SIZE = 256 * 1024;
+
+    inline int64_t queryCacheSize(int level, int64_t defaultSize)
+    {
+#if defined(__linux__) && defined(_SC_LEVEL1_DCACHE_SIZE) && defined(_SC_LEVEL2_CACHE_SIZE)
+        long size = sysconf(level == 1 ? _SC_LEVEL1_DCACHE_SIZE : _SC_LEVEL2_CACHE_SIZE);
+
+        if (size > 0)
+            return size;
+#endif
+        return defaultSize;
+    }
+
+    /// <summary>
+    /// Size of L1 data cache of one core in bytes. Queried on first call and cached.
+    /// </summary>
+    inline int64_t l1CacheSize()
+    {
+        static const int64_t size = queryCacheSize(1, DEFAULT_L1_CACHE_SIZE);
+        return size;
+    }
+
+    /// <summary>
+    /// Size of L2 cache of one core in bytes. Queried on first call and cached.
+    /// </summary>
+    inline int64_t l2CacheSize()
+    {
+        static const int64_t size = queryCacheSize(2, DEFAULT_L2_CACHE_SIZE);
+        return size;
+    }
+    } // SYMD_ISA_NAMESPACE
+}
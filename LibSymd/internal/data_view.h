@@ -5,6 +5,9 @@
 
 namespace symd::views
 {
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
     /// <summary>
     /// Data view of underlying memory buffer. Can be passes to symd methods.
     /// </summary>
@@ -62,13 +65,18 @@ namespace symd::views
     {
         return data_view<T, 2>(ptr, Dimensions({ height, width }), Dimensions({ pitch, 1 }));
     }
+    } // SYMD_ISA_NAMESPACE
 }
 
 namespace symd::__internal__
 {
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
     /////////////////////////////////////////////////////////////////////////////////////////////////
     // Access the data
     /////////////////////////////////////////////////////////////////////////////////////////////////
+    } // SYMD_ISA_NAMESPACE
 
     template <typename T, int dim>
     Dimensions getShape(const views::data_view<T, dim>& dw)
@@ -0,0 +1,982 @@
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include "symd_register.h"
+
+
+namespace symd
+{
+    namespace __internal__
+    {
+        inline namespace SYMD_ISA_NAMESPACE
+        {
+
+        /// <summary>
+        /// Number of elements of T in one full width register. SymdRegister holds SYMD_LEN elements of every type, so
+        /// kernels can mix types lane by lane. For unsigned char that uses only a quarter of register (8 of 32 bytes
+        /// with AVX2), so maps which only read and write unsigned char run on FullWidthRegister instead.
+        /// </summary>
+        template <typename T>
+        constexpr int symd_len = SYMD_LEN;
+
+    #ifdef SYMD_AVX512
+        template <>
+        constexpr int symd_len<unsigned char> = 64;
+    #elif defined SYMD_SSE
+        template <>
+        constexpr int symd_len<unsigned char> = 32;
+    #elif defined SYMD_NEON
+        template <>
+        constexpr int symd_len<unsigned char> = 16;
+    #endif
+
+        // Number of SymdRegisters needed to hold elements of one full width unsigned char register.
+        constexpr int FULL_WIDTH_PARTS = symd_len<unsigned char> / SYMD_LEN;
+
+        template <typename T>
+        class FullWidthRegister;
+
+
+        /// <summary>
+        /// N SymdRegisters processed as one value. Result of width changing conversions of FullWidthRegister, eg.
+        /// 32 unsigned chars convert to 4 registers of 8 floats with AVX2. Supports same operations as SymdRegister
+        /// by applying them to every part.
+        /// </summary>
+        template <typename T, int N>
+        class RegisterPack
+        {
+        public:
+
+            std::array<SymdRegister<T>, N> _parts;
+
+            // Constructs uninitialized pack
+            RegisterPack()
+            {
+            }
+
+            RegisterPack(const std::array<SymdRegister<T>, N>& parts)
+                : _parts(parts)
+            {
+            }
+
+            // Constructs pack with all elements equal to other
+            RegisterPack(float other)
+            {
+                _parts.fill(SymdRegister<T>(other));
+            }
+
+            // Constructs pack with all elements equal to other
+            RegisterPack(bfloat16 other)
+            {
+                _parts.fill(SymdRegister<T>(other));
+            }
+
+            // Constructs pack with all elements equal to other
+            RegisterPack(double other)
+            {
+                _parts.fill(SymdRegister<T>(other));
+            }
+
+            // Constructs pack with all elements equal to other
+            RegisterPack(int other)
+            {
+                _parts.fill(SymdRegister<T>(other));
+            }
+
+            // Constructs pack with all elements equal to other
+            RegisterPack(unsigned char other)
+            {
+                _parts.fill(SymdRegister<T>(other));
+            }
+
+            /// <summary>
+            /// Applies func to every part. Func returns SymdRegister<R>.
+            /// </summary>
+            template <typename R, typename Func>
+            RegisterPack<R, N> apply(Func&& func) const
+            {
+                RegisterPack<R, N> res;
+
+                for (int i = 0; i < N; i++)
+                    res._parts[i] = func(_parts[i]);
+
+                return res;
+            }
+
+            /// <summary>
+            /// Applies func to every pair of parts of a and b.
+            /// </summary>
+            template <typename Func>
+            static RegisterPack combine(const RegisterPack& a, const RegisterPack& b, Func&& func)
+            {
+                RegisterPack res;
+
+                for (int i = 0; i < N; i++)
+                    res._parts[i] = func(a._parts[i], b._parts[i]);
+
+                return res;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////
+            // Operators. Friends, so scalars convert to packs on either side.
+            /////////////////////////////////////////////////////////////////////////////////////
+
+            friend RegisterPack operator+(const RegisterPack& a, const RegisterPack& b)
+            {
+                return combine(a, b, [](const auto& x, const auto& y) { return x + y; });
+            }
+
+            friend RegisterPack operator-(const RegisterPack& a, const RegisterPack& b)
+            {
+                return combine(a, b, [](const auto& x, const auto& y) { return x - y; });
+            }
+
+            friend RegisterPack operator*(const RegisterPack& a, const RegisterPack& b)
+            {
+                return combine(a, b, [](const auto& x, const auto& y) { return x * y; });
+            }
+
+            friend RegisterPack operator/(const RegisterPack& a, const RegisterPack& b)
+            {
+                return combine(a, b, [](const auto& x, const auto& y) { return x / y; });
+            }
+
+            friend RegisterPack operator&(const RegisterPack& a, const RegisterPack& b)
+            {
+                return combine(a, b, [](const auto& x, const auto& y) { return x & y; });
+            }
+
+            friend RegisterPack operator|(const RegisterPack& a, const RegisterPack& b)
+            {
+                return combine(a, b, [](const auto& x, const auto& y) { return x | y; });
+            }
+
+            friend RegisterPack operator^(const RegisterPack& a, const RegisterPack& b)
+            {
+                return combine(a, b, [](const auto& x, const auto& y) { return x ^ y; });
+            }
+
+            friend RegisterPack operator==(const RegisterPack& a, const RegisterPack& b)
+            {
+                return combine(a, b, [](const auto& x, const auto& y) { return x == y; });
+            }
+
+            friend RegisterPack operator!=(const RegisterPack& a, const RegisterPack& b)
+            {
+                return combine(a, b, [](const auto& x, const auto& y) { return x != y; });
+            }
+
+            friend RegisterPack operator<(const RegisterPack& a, const RegisterPack& b)
+            {
+                return combine(a, b, [](const auto& x, const auto& y) { return x < y; });
+            }
+
+            friend RegisterPack operator>(const RegisterPack& a, const RegisterPack& b)
+            {
+                return combine(a, b, [](const auto& x, const auto& y) { return x > y; });
+            }
+
+            friend RegisterPack operator<=(const RegisterPack& a, const RegisterPack& b)
+            {
+                return combine(a, b, [](const auto& x, const auto& y) { return x <= y; });
+            }
+
+            friend RegisterPack operator>=(const RegisterPack& a, const RegisterPack& b)
+            {
+                return combine(a, b, [](const auto& x, const auto& y) { return x >= y; });
+            }
+
+            RegisterPack operator~() const
+            {
+                return apply<T>([](const auto& x) { return ~x; });
+            }
+
+            RegisterPack operator!() const
+            {
+                return ~(*this);
+            }
+
+            RegisterPack operator>>(int num_bits) const
+            {
+                return apply<T>([=](const auto& x) { return x >> num_bits; });
+            }
+
+            RegisterPack operator<<(int num_bits) const
+            {
+                return apply<T>([=](const auto& x) { return x << num_bits; });
+            }
+
+            RegisterPack& operator+=(const RegisterPack& other)
+            {
+                return *this = *this + other;
+            }
+
+            RegisterPack& operator-=(const RegisterPack& other)
+            {
+                return *this = *this - other;
+            }
+
+            RegisterPack& operator*=(const RegisterPack& other)
+            {
+                return *this = *this * other;
+            }
+
+            RegisterPack& operator/=(const RegisterPack& other)
+            {
+                return *this = *this / other;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////
+            // Functions
+            /////////////////////////////////////////////////////////////////////////////////////
+
+            RegisterPack min(const RegisterPack& other) const
+            {
+                return combine(*this, other, [](const auto& x, const auto& y) { return x.min(y); });
+            }
+
+            RegisterPack max(const RegisterPack& other) const
+            {
+                return combine(*this, other, [](const auto& x, const auto& y) { return x.max(y); });
+            }
+
+            RegisterPack abs() const
+            {
+                return apply<T>([](const auto& x) { return x.abs(); });
+            }
+
+            // This pack is mask. Lanes with mask set are taken from first, others from sec.
+            RegisterPack blend(const RegisterPack& first, const RegisterPack& sec) const
+            {
+                RegisterPack res;
+
+                for (int i = 0; i < N; i++)
+                    res._parts[i] = _parts[i].blend(first._parts[i], sec._parts[i]);
+
+                return res;
+            }
+
+            // Computes this * b + c
+            RegisterPack fmadd(const RegisterPack& b, const RegisterPack& c) const
+            {
+                RegisterPack res;
+
+                for (int i = 0; i < N; i++)
+                    res._parts[i] = _parts[i].fmadd(b._parts[i], c._parts[i]);
+
+                return res;
+            }
+
+            /// <summary>
+            /// Converts every part to R. Packs which hold one full width register of unsigned char convert back to
+            /// FullWidthRegister.
+            /// </summary>
+            template <typename R>
+            auto convert_to() const
+            {
+                auto converted = apply<R>([](const auto& x) { return x.template convert_to<R>(); });
+
+                if constexpr (std::is_same_v<R, unsigned char> && N == FULL_WIDTH_PARTS)
+                    return FullWidthRegister<R>::from_parts(converted._parts);
+                else
+                    return converted;
+            }
+
+            // Element access (slow)
+            T operator[](size_t ind) const
+            {
+                return _parts[ind / SYMD_LEN][ind % SYMD_LEN];
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////
+            // Horizontal reductions - combine all elements in one value
+            /////////////////////////////////////////////////////////////////////////////////////
+
+            T hsum() const
+            {
+                return horizontal<HorizontalOp::add>();
+            }
+
+            T hprod() const
+            {
+                return horizontal<HorizontalOp::mul>();
+            }
+
+            T hmin() const
+            {
+                return horizontal<HorizontalOp::min>();
+            }
+
+            T hmax() const
+            {
+                return horizontal<HorizontalOp::max>();
+            }
+
+            T hand() const
+            {
+                return horizontal<HorizontalOp::bit_and>();
+            }
+
+            T hor() const
+            {
+                return horizontal<HorizontalOp::bit_or>();
+            }
+
+        private:
+
+            // Parts are combined lane by lane first, then single register is reduced.
+            template <HorizontalOp Op>
+            T horizontal() const
+            {
+                auto res = _parts[0];
+
+                for (int i = 1; i < N; i++)
+                {
+                    if constexpr (Op == HorizontalOp::add)
+                        res = res + _parts[i];
+                    else if constexpr (Op == HorizontalOp::mul)
+                        res = res * _parts[i];
+                    else if constexpr (Op == HorizontalOp::min)
+                        res = res.min(_parts[i]);
+                    else if constexpr (Op == HorizontalOp::max)
+                        res = res.max(_parts[i]);
+                    else if constexpr (Op == HorizontalOp::bit_and)
+                        res = res & _parts[i];
+                    else
+                        res = res | _parts[i];
+                }
+
+                if constexpr (Op == HorizontalOp::add)
+                    return res.hsum();
+                else if constexpr (Op == HorizontalOp::mul)
+                    return res.hprod();
+                else if constexpr (Op == HorizontalOp::min)
+                    return res.hmin();
+                else if constexpr (Op == HorizontalOp::max)
+                    return res.hmax();
+                else if constexpr (Op == HorizontalOp::bit_and)
+                    return res.hand();
+                else
+                    return res.hor();
+            }
+        };
+
+
+        /// <summary>
+        /// Register of unsigned chars which uses all bytes of vector register: 32 lanes with AVX2, 64 with AVX-512.
+        /// Has same operations as SymdRegister<unsigned char>. Conversions to wider types give RegisterPack.
+        /// </summary>
+        template <typename T>
+        class FullWidthRegister
+        {
+            static_assert(std::is_same_v<T, unsigned char>, "Full width registers are supported for unsigned char.");
+
+        public:
+
+    #ifdef SYMD_AVX512
+            using Type = __m512i;
+    #elif defined SYMD_SSE
+            using Type = __m256i;
+    #elif defined SYMD_NEON
+            using Type = uint8x16_t;
+    #endif
+
+            static constexpr int LEN = symd_len<T>;
+
+            union
+            {
+                Type _reg;
+                T _ptrToData[LEN];
+            };
+
+            // Constructs uninitialized register
+            FullWidthRegister()
+            {
+            }
+
+            // Constructs register with provided SSE or NEON register
+            FullWidthRegister(Type other)
+                : _reg(other)
+            {
+            }
+
+            // Reads LEN elements from memory and constructs register
+            FullWidthRegister(const T* ptr)
+            {
+    #ifdef SYMD_AVX512
+                _reg = _mm512_loadu_si512(ptr);
+    #elif defined SYMD_SSE
+                _reg = _mm256_loadu_si256((__m256i*)ptr);
+    #elif defined SYMD_NEON
+                _reg = vld1q_u8(ptr);
+    #endif
+            }
+
+            // Reads first count elements from memory, remaining elements are zero. Memory past count is not accessed.
+            FullWidthRegister(const T* ptr, int count)
+            {
+                assert(count >= 0 && count <= LEN);
+
+    #ifdef SYMD_AVX512
+                _reg = _mm512_maskz_loadu_epi8(_first_lanes_kmask(count), ptr);
+    #else
+                // No masked byte loads - go through zeroed buffer
+                T buffer[LEN];
+                std::memset(buffer, 0, sizeof(buffer));
+                std::memcpy(buffer, ptr, count * sizeof(T));
+
+                *this = FullWidthRegister(buffer);
+    #endif
+            }
+
+            // Constructs register with all elements equal to other
+            FullWidthRegister(float other)
+            {
+                construct_from_scalar((T)other);
+            }
+
+            // Constructs register with all elements equal to other
+            FullWidthRegister(double other)
+            {
+                construct_from_scalar((T)other);
+            }
+
+            // Constructs register with all elements equal to other
+            FullWidthRegister(int other)
+            {
+                construct_from_scalar((T)other);
+            }
+
+            // Constructs register with all elements equal to other
+            FullWidthRegister(unsigned char other)
+            {
+                construct_from_scalar(other);
+            }
+
+            // Returns register with all bits set in first count elements and zeros in the remaining elements.
+            static FullWidthRegister first_lanes_mask(int count)
+            {
+    #ifdef SYMD_AVX512
+                return _mm512_movm_epi8(_first_lanes_kmask(count));
+    #elif defined SYMD_SSE
+                __m256i lanes = _mm256_setr_epi8(
+                    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+                    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31);
+
+                return _mm256_cmpgt_epi8(_mm256_set1_epi8((char)count), lanes);
+    #elif defined SYMD_NEON
+                FullWidthRegister res((T)0);
+                std::memset(res._ptrToData, 0xFF, count);
+                return res;
+    #endif
+            }
+
+            /// <summary>
+            /// Combines FULL_WIDTH_PARTS registers. Only first SYMD_LEN lanes of each part are used.
+            /// </summary>
+            static FullWidthRegister from_parts(const std::array<SymdRegister<T>, FULL_WIDTH_PARTS>& parts)
+            {
+    #ifdef SYMD_AVX512
+                __m512i res = _mm512_castsi128_si512(parts[0]._reg);
+                res = _mm512_inserti32x4(res, parts[1]._reg, 1);
+                res = _mm512_inserti32x4(res, parts[2]._reg, 2);
+                res = _mm512_inserti32x4(res, parts[3]._reg, 3);
+                return res;
+    #elif defined SYMD_SSE
+                __m128i lo = _mm_unpacklo_epi64(parts[0]._reg, parts[1]._reg);
+                __m128i hi = _mm_unpacklo_epi64(parts[2]._reg, parts[3]._reg);
+                return _mm256_set_m128i(hi, lo);
+    #elif defined SYMD_NEON
+                FullWidthRegister res;
+
+                for (int i = 0; i < FULL_WIDTH_PARTS; i++)
+                    for (int j = 0; j < SYMD_LEN; j++)
+                        res._ptrToData[i * SYMD_LEN + j] = parts[i][j];
+
+                return res;
+    #endif
+            }
+
+            /// <summary>
+            /// Elements [i * SYMD_LEN, (i + 1) * SYMD_LEN) as SymdRegister, which can be combined with registers of
+            /// other types.
+            /// </summary>
+            SymdRegister<T> part(int i) const
+            {
+                assert(i >= 0 && i < FULL_WIDTH_PARTS);
+
+    #ifdef SYMD_AVX512
+                switch (i)
+                {
+                case 0: return _mm512_castsi512_si128(_reg);
+                case 1: return _mm512_extracti32x4_epi32(_reg, 1);
+                case 2: return _mm512_extracti32x4_epi32(_reg, 2);
+                default: return _mm512_extracti32x4_epi32(_reg, 3);
+                }
+    #elif defined SYMD_SSE
+                __m128i half = i < 2 ? _mm256_castsi256_si128(_reg) : _mm256_extracti128_si256(_reg, 1);
+                return i % 2 ? _mm_srli_si128(half, 8) : half;
+    #elif defined SYMD_NEON
+                T lanes[8] = {};
+                std::memcpy(lanes, _ptrToData + i * SYMD_LEN, SYMD_LEN);
+                return vld1_u8(lanes);
+    #endif
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////
+            // Arithmetic operators. Same as in SymdRegister<unsigned char>, addition and subtraction saturate.
+            /////////////////////////////////////////////////////////////////////////////////////
+
+            FullWidthRegister operator+(const FullWidthRegister& other) const
+            {
+                return adds(other);
+            }
+
+            FullWidthRegister operator-(const FullWidthRegister& other) const
+            {
+                return subs(other);
+            }
+
+            FullWidthRegister adds(const FullWidthRegister& other) const
+            {
+    #ifdef SYMD_AVX512
+                return _mm512_adds_epu8(_reg, other._reg);
+    #elif defined SYMD_SSE
+                return _mm256_adds_epu8(_reg, other._reg);
+    #elif defined SYMD_NEON
+                return vqaddq_u8(_reg, other._reg);
+    #endif
+            }
+
+            FullWidthRegister subs(const FullWidthRegister& other) const
+            {
+    #ifdef SYMD_AVX512
+                return _mm512_subs_epu8(_reg, other._reg);
+    #elif defined SYMD_SSE
+                return _mm256_subs_epu8(_reg, other._reg);
+    #elif defined SYMD_NEON
+                return vqsubq_u8(_reg, other._reg);
+    #endif
+            }
+
+            // Rounding average (a + b + 1) >> 1
+            FullWidthRegister avg(const FullWidthRegister& other) const
+            {
+    #ifdef SYMD_AVX512
+                return _mm512_avg_epu8(_reg, other._reg);
+    #elif defined SYMD_SSE
+                return _mm256_avg_epu8(_reg, other._reg);
+    #elif defined SYMD_NEON
+                return vrhaddq_u8(_reg, other._reg);
+    #endif
+            }
+
+            FullWidthRegister& operator+=(const FullWidthRegister& other)
+            {
+                return *this = *this + other;
+            }
+
+            FullWidthRegister& operator-=(const FullWidthRegister& other)
+            {
+                return *this = *this - other;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////
+            // Bitwise operators
+            /////////////////////////////////////////////////////////////////////////////////////
+
+            FullWidthRegister operator&(const FullWidthRegister& other) const
+            {
+    #ifdef SYMD_AVX512
+                return _mm512_and_si512(_reg, other._reg);
+    #elif defined SYMD_SSE
+                return _mm256_and_si256(_reg, other._reg);
+    #elif defined SYMD_NEON
+                return vandq_u8(_reg, other._reg);
+    #endif
+            }
+
+            FullWidthRegister operator|(const FullWidthRegister& other) const
+            {
+    #ifdef SYMD_AVX512
+                return _mm512_or_si512(_reg, other._reg);
+    #elif defined SYMD_SSE
+                return _mm256_or_si256(_reg, other._reg);
+    #elif defined SYMD_NEON
+                return vorrq_u8(_reg, other._reg);
+    #endif
+            }
+
+            FullWidthRegister operator^(const FullWidthRegister& other) const
+            {
+    #ifdef SYMD_AVX512
+                return _mm512_xor_si512(_reg, other._reg);
+    #elif defined SYMD_SSE
+                return _mm256_xor_si256(_reg, other._reg);
+    #elif defined SYMD_NEON
+                return veorq_u8(_reg, other._reg);
+    #endif
+            }
+
+            FullWidthRegister operator~() const
+            {
+    #ifdef SYMD_AVX512
+                return _mm512_xor_si512(_reg, _mm512_set1_epi32(-1));
+    #elif defined SYMD_SSE
+                return _mm256_xor_si256(_reg, _mm256_set1_epi32(-1));
+    #elif defined SYMD_NEON
+                return vmvnq_u8(_reg);
+    #endif
+            }
+
+            FullWidthRegister operator!() const
+            {
+                return ~(*this);
+            }
+
+            FullWidthRegister& operator&=(const FullWidthRegister& other)
+            {
+                return *this = *this & other;
+            }
+
+            FullWidthRegister& operator|=(const FullWidthRegister& other)
+            {
+                return *this = *this | other;
+            }
+
+            FullWidthRegister& operator^=(const FullWidthRegister& other)
+            {
+                return *this = *this ^ other;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////
+            // Comparison operators
+            /////////////////////////////////////////////////////////////////////////////////////
+
+            FullWidthRegister operator==(const FullWidthRegister& other) const
+            {
+    #ifdef SYMD_AVX512
+                return _mm512_movm_epi8(_mm512_cmpeq_epi8_mask(_reg, other._reg));
+    #elif defined SYMD_SSE
+                return _mm256_cmpeq_epi8(_reg, other._reg);
+    #elif defined SYMD_NEON
+                return vceqq_u8(_reg, other._reg);
+    #endif
+            }
+
+            FullWidthRegister operator!=(const FullWidthRegister& other) const
+            {
+                return !(*this == other);
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////
+            // Functions
+            /////////////////////////////////////////////////////////////////////////////////////
+
+            FullWidthRegister min(const FullWidthRegister& other) const
+            {
+    #ifdef SYMD_AVX512
+                return _mm512_min_epu8(_reg, other._reg);
+    #elif defined SYMD_SSE
+                return _mm256_min_epu8(_reg, other._reg);
+    #elif defined SYMD_NEON
+                return vminq_u8(_reg, other._reg);
+    #endif
+            }
+
+            FullWidthRegister max(const FullWidthRegister& other) const
+            {
+    #ifdef SYMD_AVX512
+                return _mm512_max_epu8(_reg, other._reg);
+    #elif defined SYMD_SSE
+                return _mm256_max_epu8(_reg, other._reg);
+    #elif defined SYMD_NEON
+                return vmaxq_u8(_reg, other._reg);
+    #endif
+            }
+
+            FullWidthRegister abs() const
+            {
+                return *this;
+            }
+
+            // This register is mask. Lanes with mask set are taken from first, others from sec.
+            FullWidthRegister blend(const FullWidthRegister& first, const FullWidthRegister& sec) const
+            {
+    #ifdef SYMD_AVX512
+                return _mm512_mask_blend_epi8(_mm512_movepi8_mask(_reg), sec._reg, first._reg);
+    #elif defined SYMD_SSE
+                return _mm256_blendv_epi8(sec._reg, first._reg, _reg);
+    #elif defined SYMD_NEON
+                return vbslq_u8(_reg, first._reg, sec._reg);
+    #endif
+            }
+
+            /// <summary>
+            /// Converts to R. Result has LEN elements, so for other types than unsigned char it is RegisterPack
+            /// of FULL_WIDTH_PARTS SymdRegisters.
+            /// </summary>
+            template <typename R>
+            auto convert_to() const
+            {
+                if constexpr (std::is_same_v<R, T>)
+                {
+                    return *this;
+                }
+                else
+                {
+                    RegisterPack<R, FULL_WIDTH_PARTS> res;
+
+                    for (int i = 0; i < FULL_WIDTH_PARTS; i++)
+                        res._parts[i] = part(i).template convert_to<R>();
+
+                    return res;
+                }
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////
+            // Store
+            /////////////////////////////////////////////////////////////////////////////////////
+
+            void store(T* dst) const
+            {
+    #ifdef SYMD_AVX512
+                _mm512_storeu_si512(dst, _reg);
+    #elif defined SYMD_SSE
+                _mm256_storeu_si256((__m256i*)dst, _reg);
+    #elif defined SYMD_NEON
+                vst1q_u8(dst, _reg);
+    #endif
+            }
+
+            // Non-temporal store which bypasses cache. dst must be aligned to size of register.
+            void store_stream(T* dst) const
+            {
+                assert((uintptr_t)dst % sizeof(Type) == 0);
+
+    #ifdef SYMD_AVX512
+                _mm512_stream_si512((__m512i*)dst, _reg);
+    #elif defined SYMD_SSE
+                _mm256_stream_si256((__m256i*)dst, _reg);
+    #elif defined SYMD_NEON
+                vst1q_u8(dst, _reg);
+    #endif
+            }
+
+            // Stores first count elements to dst. Memory past count is not touched.
+            void store(T* dst, int count) const
+            {
+                assert(count >= 0 && count <= LEN);
+
+    #ifdef SYMD_AVX512
+                _mm512_mask_storeu_epi8(dst, _first_lanes_kmask(count), _reg);
+    #else
+                std::memcpy(dst, _ptrToData, count * sizeof(T));
+    #endif
+            }
+
+            // Element access (slow)
+            T operator[](size_t ind) const
+            {
+                return _ptrToData[ind];
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////
+            // Horizontal reductions - combine all elements in one value
+            /////////////////////////////////////////////////////////////////////////////////////
+
+            T hsum() const
+            {
+                return horizontal<HorizontalOp::add>();
+            }
+
+            T hprod() const
+            {
+                return horizontal<HorizontalOp::mul>();
+            }
+
+            T hmin() const
+            {
+                return horizontal<HorizontalOp::min>();
+            }
+
+            T hmax() const
+            {
+                return horizontal<HorizontalOp::max>();
+            }
+
+            T hand() const
+            {
+                return horizontal<HorizontalOp::bit_and>();
+            }
+
+            T hor() const
+            {
+                return horizontal<HorizontalOp::bit_or>();
+            }
+
+        private:
+
+            // Combines all lanes with Op. Halves are combined until 16 bytes remain, than as in SymdRegister.
+            template <HorizontalOp Op>
+            T horizontal() const
+            {
+                if constexpr (Op == HorizontalOp::mul)
+                {
+                    // No 8 bit multiplication
+                    T res = _ptrToData[0];
+
+                    for (int i = 1; i < LEN; i++)
+                        res = (T)(res * _ptrToData[i]);
+
+                    return res;
+                }
+                else
+                {
+    #ifdef SYMD_SSE
+                    auto op = [](__m128i a, __m128i b)
+                    {
+                        if constexpr (Op == HorizontalOp::add)
+                            return _mm_add_epi8(a, b);
+                        else if constexpr (Op == HorizontalOp::min)
+                            return _mm_min_epu8(a, b);
+                        else if constexpr (Op == HorizontalOp::max)
+                            return _mm_max_epu8(a, b);
+                        else if constexpr (Op == HorizontalOp::bit_and)
+                            return _mm_and_si128(a, b);
+                        else
+                            return _mm_or_si128(a, b);
+                    };
+
+        #ifdef SYMD_AVX512
+                    __m128i v = op(
+                        op(_mm512_castsi512_si128(_reg), _mm512_extracti32x4_epi32(_reg, 1)),
+                        op(_mm512_extracti32x4_epi32(_reg, 2), _mm512_extracti32x4_epi32(_reg, 3)));
+        #else
+                    __m128i v = op(_mm256_castsi256_si128(_reg), _mm256_extracti128_si256(_reg, 1));
+        #endif
+                    v = op(v, _mm_srli_si128(v, 8));
+                    v = op(v, _mm_srli_si128(v, 4));
+                    v = op(v, _mm_srli_si128(v, 2));
+                    v = op(v, _mm_srli_si128(v, 1));
+                    return (T)_mm_cvtsi128_si32(v);
+    #elif defined SYMD_NEON
+                    T res = _ptrToData[0];
+
+                    for (int i = 1; i < LEN; i++)
+                    {
+                        if constexpr (Op == HorizontalOp::add)
+                            res = (T)(res + _ptrToData[i]);
+                        else if constexpr (Op == HorizontalOp::min)
+                            res = std::min(res, _ptrToData[i]);
+                        else if constexpr (Op == HorizontalOp::max)
+                            res = std::max(res, _ptrToData[i]);
+                        else if constexpr (Op == HorizontalOp::bit_and)
+                            res = (T)(res & _ptrToData[i]);
+                        else
+                            res = (T)(res | _ptrToData[i]);
+                    }
+
+                    return res;
+    #endif
+                }
+            }
+
+            void construct_from_scalar(T other)
+            {
+    #ifdef SYMD_AVX512
+                _reg = _mm512_set1_epi8((char)other);
+    #elif defined SYMD_SSE
+                _reg = _mm256_set1_epi8((char)other);
+    #elif defined SYMD_NEON
+                _reg = vdupq_n_u8(other);
+    #endif
+            }
+
+    #ifdef SYMD_AVX512
+            static __mmask64 _first_lanes_kmask(int count)
+            {
+                return count >= 64 ? ~(__mmask64)0 : (((__mmask64)1 << count) - 1);
+            }
+    #endif
+        };
+
+        } // SYMD_ISA_NAMESPACE
+    } // __internal__
+} // symd
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// STD functions (min max abs)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace std
+{
+    template <typename T>
+    inline symd::__internal__::FullWidthRegister<T> min(
+        const symd::__internal__::FullWidthRegister<T>& first,
+        const symd::__internal__::FullWidthRegister<T>& sec)
+    {
+        return first.min(sec);
+    }
+
+    template <typename T>
+    inline symd::__internal__::FullWidthRegister<T> max(
+        const symd::__internal__::FullWidthRegister<T>& first,
+        const symd::__internal__::FullWidthRegister<T>& sec)
+    {
+        return first.max(sec);
+    }
+
+    template <typename T>
+    inline symd::__internal__::FullWidthRegister<T> min(const symd::__internal__::FullWidthRegister<T>& first, T sec)
+    {
+        return first.min(sec);
+    }
+
+    template <typename T>
+    inline symd::__internal__::FullWidthRegister<T> max(const symd::__internal__::FullWidthRegister<T>& first, T sec)
+    {
+        return first.max(sec);
+    }
+
+    template <typename T>
+    inline symd::__internal__::FullWidthRegister<T> abs(const symd::__internal__::FullWidthRegister<T>& reg)
+    {
+        return reg.abs();
+    }
+
+    template <typename T, int N>
+    inline symd::__internal__::RegisterPack<T, N> min(
+        const symd::__internal__::RegisterPack<T, N>& first,
+        const symd::__internal__::RegisterPack<T, N>& sec)
+    {
+        return first.min(sec);
+    }
+
+    template <typename T, int N>
+    inline symd::__internal__::RegisterPack<T, N> max(
+        const symd::__internal__::RegisterPack<T, N>& first,
+        const symd::__internal__::RegisterPack<T, N>& sec)
+    {
+        return first.max(sec);
+    }
+
+    template <typename T, int N>
+    inline symd::__internal__::RegisterPack<T, N> min(const symd::__internal__::RegisterPack<T, N>& first, T sec)
+    {
+        return first.min(sec);
+    }
+
+    template <typename T, int N>
+    inline symd::__internal__::RegisterPack<T, N> max(const symd::__internal__::RegisterPack<T, N>& first, T sec)
+    {
+        return first.max(sec);
+    }
+
+    template <typename T, int N>
+    inline symd::__internal__::RegisterPack<T, N> abs(const symd::__internal__::RegisterPack<T, N>& reg)
+    {
+        return reg.abs();
+    }
+} // std
@@ -0,0 +1,104 @@
+#pragma once
+#include <type_traits>
+#include "basic_views.h"
+#include "row_cursor.h"
+#include "streaming_view.h"
+
+
+namespace symd::__internal__
+{
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
+    /// <summary>
+    /// Output view of unsigned char which opts map in full width registers. Kernel receives FullWidthRegister
+    /// (and RegisterPack after conversions) instead of SymdRegister, so it must be written for both (see
+    /// kernel/full_width.h).
+    /// </summary>
+    template <typename View>
+    struct FullWidthView
+    {
+        View _underlyingView;
+
+        FullWidthView(View&& view)
+            : _underlyingView(std::forward<View>(view))
+        {
+        }
+    };
+    } // SYMD_ISA_NAMESPACE
+
+    template <typename View>
+    Dimensions getShape(const FullWidthView<View>& fv)
+    {
+        return getShape(fv._underlyingView);
+    }
+
+    template <typename View>
+    Dimensions getPitch(const FullWidthView<View>& fv)
+    {
+        return getPitch(fv._underlyingView);
+    }
+
+    template <typename View>
+    auto getDataPtr(FullWidthView<View>& fv, const Dimensions& coords)
+        -> decltype(getDataPtr(fv._underlyingView, coords))
+    {
+        return getDataPtr(fv._underlyingView, coords);
+    }
+
+    template <typename View>
+    auto getDataPtr(const FullWidthView<View>& fv, const Dimensions& coords)
+        -> decltype(getDataPtr(fv._underlyingView, coords))
+    {
+        return getDataPtr(fv._underlyingView, coords);
+    }
+
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
+    /// <summary>
+    /// Row cursor of underlying view, marked so map uses full width registers when all inputs are unsigned char.
+    /// </summary>
+    template <typename Cursor>
+    struct FullWidthRowCursor : Cursor
+    {
+    };
+
+    template <typename Cursor>
+    constexpr bool isFullWidthCursor<FullWidthRowCursor<Cursor>> = isByteCursor<Cursor>;
+
+    template <typename View>
+    auto rowCursor(FullWidthView<View>& fv, const Dimensions& rowCoords)
+    {
+        using Cursor = decltype(rowCursor(fv._underlyingView, rowCoords));
+        static_assert(isByteCursor<Cursor>, "Full width view requires unsigned char view with underlying memory.");
+
+        return FullWidthRowCursor<Cursor>{ rowCursor(fv._underlyingView, rowCoords) };
+    }
+
+    template <typename View>
+    void finishMap(FullWidthView<View>& fv)
+    {
+        finishMap(fv._underlyingView);
+    }
+    } // SYMD_ISA_NAMESPACE
+}
+
+namespace symd::views
+{
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
+    /// <summary>
+    /// Wraps unsigned char output view, so map processes symd_len<unsigned char> elements (32 with AVX2) per
+    /// iteration instead of SYMD_LEN. Used only when all inputs are unsigned char memory too. Kernel must accept
+    /// FullWidthRegister and RegisterPack, which is true for operators and for kernels of kernel/full_width.h.
+    /// </summary>
+    /// <param name="view">Underlying output view of unsigned char (vector, data_view, Tensor, streaming view...).</param>
+    template <typename View>
+    auto full_width(View&& view)
+    {
+        return __internal__::FullWidthView<View>(std::forward<View>(view));
+    }
+    } // SYMD_ISA_NAMESPACE
+}
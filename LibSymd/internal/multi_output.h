@@ -1,8 +1,11 @@
 #pragma once
 #include "symd_register.h"
 #include "region.h"
+#include "row_cursor.h"
+#include "streaming_view.h"
 #include <utility>
 #include <array>
+#include <tuple>
 
 
 namespace symd::__internal__
@@ -19,6 +22,9 @@ namespace symd::__internal__
         return getShape(views[0]);
     }
 
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
     template<typename Tuple, typename Elements, size_t... I>
     void saveDataImpl(Tuple& views, const Elements& elements, const Dimensions& coords, std::index_sequence<I...>)
     {
@@ -89,4 +95,190 @@ namespace symd::__internal__
     {
         return sub_view_tuple_Impl(views, region, std::make_index_sequence<sizeof...(Views)>{});
     }
+
+
+    template <typename... Views>
+    uint32_t splitMask(const std::tuple<Views...>& views)
+    {
+        return std::apply([](const auto&... view) { return (splitMask(view) & ...); }, views);
+    }
+
+    template <typename View, size_t N, typename std::enable_if<!UnderlyingRegister<View>::is_supported_type(), int>::type = 0>
+    uint32_t splitMask(const std::array<View, N>& views)
+    {
+        uint32_t res = ~0u;
+
+        for (const auto& view : views)
+            res &= splitMask(view);
+
+        return res;
+    }
+
+    template <typename... Views>
+    void prepareRegionPartials(std::tuple<Views...>& views, size_t numRegions)
+    {
+        std::apply([&](auto&... view) { (prepareRegionPartials(view, numRegions), ...); }, views);
+    }
+
+    template <typename View, size_t N>
+    void prepareRegionPartials(std::array<View, N>& views, size_t numRegions)
+    {
+        for (auto& view : views)
+            prepareRegionPartials(view, numRegions);
+    }
+
+    template <typename Tuple, typename SubTuple, size_t... I>
+    void storeRegionPartialTupleImpl(Tuple& views, const SubTuple& subViews, size_t regionInd, std::index_sequence<I...>)
+    {
+        (storeRegionPartial(std::get<I>(views), std::get<I>(subViews), regionInd), ...);
+    }
+
+    template <typename... Views, typename... SubViews>
+    void storeRegionPartial(std::tuple<Views...>& views, const std::tuple<SubViews...>& subViews, size_t regionInd)
+    {
+        storeRegionPartialTupleImpl(views, subViews, regionInd, std::make_index_sequence<sizeof...(Views)>{});
+    }
+
+    template <typename View, typename SubView, size_t N>
+    void storeRegionPartial(std::array<View, N>& views, const std::array<SubView, N>& subViews, size_t regionInd)
+    {
+        for (size_t i = 0; i < N; i++)
+            storeRegionPartial(views[i], subViews[i], regionInd);
+    }
+
+    template <typename... Views>
+    void combineRegionPartials(std::tuple<Views...>& views)
+    {
+        std::apply([](auto&... view) { (combineRegionPartials(view), ...); }, views);
+    }
+
+    template <typename View, size_t N>
+    void combineRegionPartials(std::array<View, N>& views)
+    {
+        for (auto& view : views)
+            combineRegionPartials(view);
+    }
+
+    template <typename... Views>
+    void finishMap(std::tuple<Views...>& views)
+    {
+        std::apply([](auto&... view) { (finishMap(view), ...); }, views);
+    }
+
+    template <typename View, size_t N>
+    void finishMap(std::array<View, N>& views)
+    {
+        for (auto& view : views)
+            finishMap(view);
+    }
+
+
+    /// <summary>
+    /// Row cursor over multiple outputs. Saves i-th element of operation result to i-th output.
+    /// </summary>
+    template <typename... Cursors>
+    struct MultiRowCursor
+    {
+        static constexpr bool supports_partial = (Cursors::supports_partial && ...);
+
+        std::tuple<Cursors...> _cursors;
+
+        template<typename Elements, size_t... I>
+        void saveImpl(int64_t i, const Elements& elements, std::index_sequence<I...>)
+        {
+            (std::get<I>(_cursors).save(i, elements[I]), ...);
+        }
+
+        template<typename Elements, size_t... I>
+        void saveVecImpl(int64_t i, const Elements& elements, std::index_sequence<I...>)
+        {
+            (std::get<I>(_cursors).saveVec(i, elements[I]), ...);
+        }
+
+        template<typename Elements, size_t... I>
+        void saveVecPartialImpl(int64_t i, const Elements& elements, int count, std::index_sequence<I...>)
+        {
+            (std::get<I>(_cursors).saveVecPartial(i, elements[I], count), ...);
+        }
+
+        template <typename Elements>
+        void saveVecPartial(int64_t i, const Elements& elements, int count)
+        {
+            saveVecPartialImpl(i, elements, count, std::index_sequence_for<Cursors...>{});
+        }
+
+        template <typename Elements>
+        void save(int64_t i, const Elements& elements)
+        {
+            saveImpl(i, elements, std::index_sequence_for<Cursors...>{});
+        }
+
+        template <typename Elements>
+        void saveVec(int64_t i, const Elements& elements)
+        {
+            saveVecImpl(i, elements, std::index_sequence_for<Cursors...>{});
+        }
+    };
+
+    template <typename... Cursors>
+    void finishRow(MultiRowCursor<Cursors...>& cursor)
+    {
+        std::apply([](auto&... c) { (finishRow(c), ...); }, cursor._cursors);
+    }
+
+    template <typename Tuple, size_t... I>
+    auto rowCursorTupleImpl(Tuple& views, const Dimensions& rowCoords, std::index_sequence<I...>)
+    {
+        using CursorsT = MultiRowCursor<decltype(rowCursor(std::get<I>(views), rowCoords))...>;
+        return CursorsT{ std::make_tuple(rowCursor(std::get<I>(views), rowCoords)...) };
+    }
+
+    template <typename... Views>
+    auto rowCursor(std::tuple<Views...>& views, const Dimensions& rowCoords)
+    {
+        return rowCursorTupleImpl(views, rowCoords, std::make_index_sequence<sizeof...(Views)>{});
+    }
+
+    template <typename View, size_t N, typename std::enable_if<!UnderlyingRegister<View>::is_supported_type(), int>::type = 0>
+    auto rowCursor(std::array<View, N>& views, const Dimensions& rowCoords)
+    {
+        return rowCursorTupleImpl(views, rowCoords, std::make_index_sequence<N>{});
+    }
+
+    template <typename Tuple, size_t... I>
+    bool isDenseTupleImpl(const Tuple& views, std::index_sequence<I...>)
+    {
+        return (isDense(std::get<I>(views)) && ...);
+    }
+
+    template <typename... Views>
+    bool isDense(const std::tuple<Views...>& views)
+    {
+        return isDenseTupleImpl(views, std::make_index_sequence<sizeof...(Views)>{});
+    }
+
+    template <typename View, size_t N, typename std::enable_if<!UnderlyingRegister<View>::is_supported_type(), int>::type = 0>
+    bool isDense(const std::array<View, N>& views)
+    {
+        return isDenseTupleImpl(views, std::make_index_sequence<N>{});
+    }
+
+    template <typename Tuple, size_t... I>
+    constexpr int64_t elementSizeTupleImpl(const Tuple& views, std::index_sequence<I...>)
+    {
+        return (elementSize(std::get<I>(views)) + ...);
+    }
+
+    template <typename... Views>
+    constexpr int64_t elementSize(const std::tuple<Views...>& views)
+    {
+        return elementSizeTupleImpl(views, std::make_index_sequence<sizeof...(Views)>{});
+    }
+
+    template <typename View, size_t N, typename std::enable_if<!UnderlyingRegister<View>::is_supported_type(), int>::type = 0>
+    constexpr int64_t elementSize(const std::array<View, N>& views)
+    {
+        return elementSizeTupleImpl(views, std::make_index_sequence<N>{});
+    }
+    } // SYMD_ISA_NAMESPACE
 }
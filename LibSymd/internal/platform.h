@@ -0,0 +1,42 @@
+#pragma once
+
+// Platform check macros
+// https://abseil.io/docs/cpp/platforms/macros#architecture
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    #define SYMD_SSE 100
+    #include <immintrin.h>
+
+    // AVX-512 is opt in, since it doubles number of elements processed at once.
+    // Define SYMD_USE_AVX512 and compile for target with AVX-512 F, BW, DQ and VL (Skylake-X, Sapphire Rapids, Zen 4).
+    #if defined(SYMD_USE_AVX512) && defined(__AVX512F__) && defined(__AVX512BW__) && defined(__AVX512DQ__) && defined(__AVX512VL__)
+        #define SYMD_AVX512 100
+    #endif
+
+    // FMA3 came with AVX2 on all Intel and AMD CPUs, but compilers enable it separately (-mfma or -march).
+    #if defined(__FMA__) || defined(SYMD_AVX512) || (defined(_MSC_VER) && defined(__AVX2__))
+        #define SYMD_FMA 100
+    #endif
+#elif defined(_M_ARM64) || defined(_M_ARM) || defined(__aarch64__) || defined (__arm__)
+    #define SYMD_NEON 100
+    #define SYMD_FMA 100
+    #include <arm_neon.h>
+#endif
+
+// All of Symd lives in inline namespace named after instruction set (e.g. symd::isa_avx2, symd::kernel::isa_avx2).
+// Header only code is compiled into every object file which includes it, with compiler flags of that file. Without
+// distinct names, object files compiled for different instruction sets would define the same symbols with different
+// code (and different SYMD_LEN), and linker would keep one of them for all. This allows same kernel source to be
+// compiled for several instruction sets and linked into one binary (see cpu_dispatch.h).
+//
+// Only view access functions (getShape, getPitch, getDataPtr) are declared directly in symd::__internal__, next to
+// overloads users add for their own classes (see README). Inside of inline namespace they would hide user overloads.
+// Their parameter or return types are Symd types, so their names differ per instruction set too.
+// ThreadPool is shared by all instruction sets on purpose (one set of pools and pinned cores per process).
+#if defined SYMD_AVX512
+    #define SYMD_ISA_NAMESPACE isa_avx512
+#elif defined SYMD_SSE
+    #define SYMD_ISA_NAMESPACE isa_avx2
+#elif defined SYMD_NEON
+    #define SYMD_ISA_NAMESPACE isa_neon
+#endif
@@ -3,24 +3,74 @@
 #include "../dimensions.h"
 #include "region.h"
 #include <cassert>
-#include <mutex>
-#include <functional>
+#include <vector>
+#include <algorithm>
 
 
+namespace symd::__internal__
+{
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
+    /// <summary>
+    /// Result of reduction of one region, padded to cache line.
+    /// </summary>
+    template <typename T>
+    struct alignas(64) RegionPartial
+    {
+        T value;
+    };
+    } // SYMD_ISA_NAMESPACE
+}
+
 namespace symd::views
 {
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
+    /// <summary>
+    /// Built-in reduce operations. reduce_view finishes them with horizontal reduction of its register instead of
+    /// applying operation lane by lane.
+    /// </summary>
+    struct reduce_sum
+    {
+        template <typename T>
+        T operator()(const T& x, const T& y) const
+        {
+            return x + y;
+        }
+    };
+
+    struct reduce_min
+    {
+        template <typename T>
+        T operator()(const T& x, const T& y) const
+        {
+            return std::min(x, y);
+        }
+    };
+
+    struct reduce_max
+    {
+        template <typename T>
+        T operator()(const T& x, const T& y) const
+        {
+            return std::max(x, y);
+        }
+    };
+
     /// <summary>
     /// View used for reduction operation. Perform symd::map to this view in order to perform reductions.
     /// </summary>
     template <typename T, typename ReduceOperation>
     struct reduce_view
     {
-        std::shared_ptr<std::mutex> _final_sum_mutex;
-        std::function<void(const reduce_view<T, ReduceOperation>& self)> _finalizer;
-
         T _sum;
         __internal__::SymdRegister<T> _regSum;
 
+        // Results of regions of parallel map, each on its own cache line so workers do not share lines.
+        std::vector<__internal__::RegionPartial<T>> _partials;
+
     public:
         const Dimensions _shape;
         const T _startValue;
@@ -41,34 +91,12 @@ namespace symd::views
         /// <param name="startValue">Value for initializing operation / neutral element for operation. Eg 0 for addition or 1 for multiplication.</param>
         /// <param name="reduceOperation">Input operation lambda function.</param>
         reduce_view(const Dimensions& shape, const T& startValue, const ReduceOperation& reduceOperation)
-            : _reduceOperation(reduceOperation)
-            , _shape(shape)
-            , _startValue(startValue)
-        {
-            _sum = startValue;
-            _regSum = __internal__::SymdRegister<T>(startValue);
-
-            _final_sum_mutex = std::make_shared<std::mutex>();
-            _finalizer = [](const reduce_view<T, ReduceOperation>& self) {
-            };
-        }
-
-        /// <summary>
-        /// Constructs reduce_view given reduce operation and finalizer - DO NOT USE, FOR INTERNAL USE ONLY.
-        /// </summary>
-        /// <param name="shape">shape of input view you want to perform reduction on.</param>
-        /// <param name="startValue">Value for initializing operation / neutral element for operation. Eg 0 for addition or 1 for multiplication.</param>
-        /// <param name="reduceOperation">Input operation lambda function.</param>
-        /// <param name="finalizer">Lambda function to be executed on *this before this is destructed. Needed for correct parallel reduction implementation.</param>
-        reduce_view(const Dimensions& shape, const T& startValue, const ReduceOperation& reduceOperation,
-            std::function<void(const reduce_view& self)>&& finalizer)
-            : _reduceOperation(reduceOperation)
-            , _shape(shape)
+            : _shape(shape)
             , _startValue(startValue)
+            , _reduceOperation(reduceOperation)
         {
             _sum = startValue;
             _regSum = __internal__::SymdRegister<T>(startValue);
-            _finalizer = std::move(finalizer);
         }
 
         /// <summary>
@@ -90,17 +118,14 @@ namespace symd::views
         }
 
         /// <summary>
-        /// Appends input data to reduce_view, but is thread safe. INTERNAL - DO NOT USE.
+        /// Appends first count elements of input SymdRegister to reduce_view. INTERNAL - DO NOT USE.
         /// </summary>
-        /// <param name="x">Data to be appended.</param>
-        void threadSafeAppend(const T& x)
+        /// <param name="x">SymdRegister to be appended.</param>
+        /// <param name="count">Number of valid elements in x.</param>
+        void appendPartial(const __internal__::SymdRegister<T>& x, int count)
         {
-            if (_final_sum_mutex)
-            {
-                std::lock_guard<std::mutex> guard(*_final_sum_mutex);
-                _sum = _reduceOperation(_sum, x);
-                // std::cout << "Bla " << x << std::endl;
-            }
+            auto mask = __internal__::SymdRegister<T>::first_lanes_mask(count);
+            _regSum = _reduceOperation(_regSum, mask.blend(x, __internal__::SymdRegister<T>(_startValue)));
         }
 
         /// <summary>
@@ -108,21 +133,27 @@ namespace symd::views
         /// </summary>
         T getResult() const
         {
-            auto res = _sum;
-
-            for (int i = 0; i < __internal__::SYMD_LEN; i++)
+            if constexpr (std::is_same_v<ReduceOperation, reduce_sum>)
+                return _reduceOperation(_sum, _regSum.hsum());
+            else if constexpr (std::is_same_v<ReduceOperation, reduce_min>)
+                return _reduceOperation(_sum, _regSum.hmin());
+            else if constexpr (std::is_same_v<ReduceOperation, reduce_max>)
+                return _reduceOperation(_sum, _regSum.hmax());
+            else
             {
-                res = _reduceOperation(res, _regSum[i]);
-            }
+                // Custom operations work on registers and scalars only, lanes are combined one by one.
+                auto res = _sum;
 
-            return res;
-        }
+                for (int i = 0; i < __internal__::SYMD_LEN; i++)
+                {
+                    res = _reduceOperation(res, _regSum[i]);
+                }
 
-        ~reduce_view()
-        {
-            _finalizer(*this);
+                return res;
+            }
         }
     };
+    } // SYMD_ISA_NAMESPACE
 }
 
 
@@ -140,6 +171,50 @@ namespace symd::__internal__
         return reductor._shape.native_pitch();
     }
 
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
+    /// <summary>
+    /// Row cursor of reduce_view. Coordinates do not matter for reduction, everything is appended.
+    /// </summary>
+    template <typename T, typename ReduceOperation>
+    struct ReduceRowCursor
+    {
+        static constexpr bool supports_partial = true;
+
+        views::reduce_view<T, ReduceOperation>* _reductor;
+
+        void save(int64_t, const T& element)
+        {
+            _reductor->append(element);
+        }
+
+        void saveVec(int64_t, const SymdRegister<T>& element)
+        {
+            _reductor->append(element);
+        }
+
+        void saveVecPartial(int64_t, const SymdRegister<T>& element, int count)
+        {
+            _reductor->appendPartial(element, count);
+        }
+    };
+
+    template <typename T, typename ReduceOperation>
+    auto rowCursor(views::reduce_view<T, ReduceOperation>& reductor, const Dimensions&)
+    {
+        return ReduceRowCursor<T, ReduceOperation>{ &reductor };
+    }
+
+    /// <summary>
+    /// Reduction does not depend on order of elements so reduce_view can always be traversed as flat row.
+    /// </summary>
+    template <typename T, typename ReduceOperation>
+    bool isDense(const views::reduce_view<T, ReduceOperation>&)
+    {
+        return true;
+    }
+
     /*template <typename T, typename ReduceOperation>
     auto fetchData(const views::reduce_view<T, ReduceOperation>& reductor, const Dimensions& coords)
     {
@@ -182,11 +257,63 @@ namespace symd::__internal__
     template<typename T, typename ReduceOperation>
     auto sub_view(views::reduce_view<T, ReduceOperation>& view, const Region& region)
     {
-        // sub_view from reduce_view is smaller reduce_view
-        return views::reduce_view<T, ReduceOperation>(region.getShape(), view._startValue, view._reduceOperation,
-            [&](const views::reduce_view<T, ReduceOperation>& self)
-            {
-                view.threadSafeAppend(self.getResult());
-            });
+        // sub_view from reduce_view is smaller reduce_view, its result is stored with storeRegionPartial
+        return views::reduce_view<T, ReduceOperation>(region.getShape(), view._startValue, view._reduceOperation);
+    }
+
+    /// <summary>
+    /// Views other than reductions have no per region results.
+    /// </summary>
+    template <typename View>
+    void prepareRegionPartials(View&, size_t)
+    {
+    }
+
+    template <typename View, typename SubView>
+    void storeRegionPartial(View&, const SubView&, size_t)
+    {
+    }
+
+    template <typename View>
+    void combineRegionPartials(View&)
+    {
+    }
+
+    /// <summary>
+    /// Makes one partial result slot per region of parallel map.
+    /// </summary>
+    template <typename T, typename ReduceOperation>
+    void prepareRegionPartials(views::reduce_view<T, ReduceOperation>& view, size_t numRegions)
+    {
+        view._partials.assign(numRegions, RegionPartial<T>{ view._startValue });
+    }
+
+    /// <summary>
+    /// Stores result of region. Every region has its own slot, so no locking is needed.
+    /// </summary>
+    template <typename T, typename ReduceOperation>
+    void storeRegionPartial(views::reduce_view<T, ReduceOperation>& view, const views::reduce_view<T, ReduceOperation>& subView, size_t regionInd)
+    {
+        view._partials[regionInd].value = subView.getResult();
+    }
+
+    /// <summary>
+    /// Combines region results in pairwise tree by region index. Order does not depend on which worker
+    /// finished first, so floating point results are same from run to run.
+    /// </summary>
+    template <typename T, typename ReduceOperation>
+    void combineRegionPartials(views::reduce_view<T, ReduceOperation>& view)
+    {
+        auto& partials = view._partials;
+
+        for (size_t step = 1; step < partials.size(); step *= 2)
+            for (size_t i = 0; i + step < partials.size(); i += 2 * step)
+                partials[i].value = view._reduceOperation(partials[i].value, partials[i + step].value);
+
+        if (!partials.empty())
+            view.append(partials[0].value);
+
+        partials.clear();
     }
+    } // SYMD_ISA_NAMESPACE
 }
@@ -1,11 +1,17 @@
 #pragma once
 #include <vector>
 #include <utility>
+#include <algorithm>
+#include <cstdint>
+#include <cassert>
 #include "../dimensions.h"
 
 
 namespace symd::__internal__
 {
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
     /// <summary>
     /// Inclusive region. Used to help parallel compute.
     /// </summary>
@@ -43,12 +49,16 @@ namespace symd::__internal__
         }
 
         /// <summary>
-        /// Splits the Region in two roughly equal parts.
+        /// Recursively splits the Region in two roughly equal parts until parts have less than minRegionSize elements.
         /// </summary>
-        /// <returns>Two disjoint regions with cover the source region.</returns>
-        void split(std::vector<Region>& result) const
+        /// <param name="result">Disjoint regions which cover the source region are appended here.</param>
+        /// <param name="minRegionSize">Regions smaller than this are not split further.</param>
+        /// <param name="splitMask">Bit i is set if dimension i can be split.</param>
+        void split(std::vector<Region>& result, int64_t minRegionSize = 100000, uint32_t splitMask = ~0u) const
         {
-            if (this->num_elements() < 100000)
+            assert(minRegionSize >= 1);
+
+            if (this->num_elements() < minRegionSize)
             {
                 result.push_back(*this);
                 return;
@@ -58,14 +68,74 @@ namespace symd::__internal__
 
             for (int i = 0; i < shape.num_dims(); i++)
             {
-                if (shape[i] > 1)
+                if (shape[i] > 1 && ((splitMask >> i) & 1u))
                 {
                     int64_t mid = shape[i] / 2;
                     
-                    Region(startCoord, endCoord.with_i(i, startCoord[i] + mid  - 1)).split(result);
-                    Region(startCoord.with_i(i, startCoord[i] + mid), endCoord).split(result);
+                    Region(startCoord, endCoord.with_i(i, startCoord[i] + mid  - 1)).split(result, minRegionSize, splitMask);
+                    Region(startCoord.with_i(i, startCoord[i] + mid), endCoord).split(result, minRegionSize, splitMask);
+                    return;
                 }
             }
+
+            // Single element region (or region with only unsplittable dims) can't be split
+            result.push_back(*this);
+        }
+
+        /// <summary>
+        /// Splits the Region in tiles which stay in cache while they are processed. Rows of the vertical stencil
+        /// window (2 * border + 1 rows of tile width) fit in half of L1, whole tile together with its halo fits in
+        /// half of L2. Tiles span whole rows whenever the window fits in L1, and neighbouring tiles are next to
+        /// each other in result, so consecutive tiles on one worker share halo rows.
+        /// </summary>
+        /// <param name="result">Disjoint tiles which cover the source region are appended here.</param>
+        /// <param name="border">Stencil border of inputs (getBorder).</param>
+        /// <param name="bytesPerElement">Sum of element sizes of all inputs and outputs.</param>
+        /// <param name="l1Bytes">L1 data cache size.</param>
+        /// <param name="l2Bytes">L2 cache size.</param>
+        void tile(std::vector<Region>& result, const Dimensions& border, int64_t bytesPerElement, int64_t l1Bytes, int64_t l2Bytes) const
+        {
+            auto shape = this->getShape();
+            auto tileShape = shape;
+
+            const int lastDim = shape.num_dims() - 1;
+            bytesPerElement = std::max(bytesPerElement, (int64_t)1);
+            const int64_t l2Elements = std::max(l2Bytes / 2 / bytesPerElement, (int64_t)1);
+
+            int64_t tileWidth = shape[lastDim];
+
+            if (lastDim > 0)
+            {
+                int64_t windowRows = 2 * border[lastDim - 1] + 1;
+                int64_t l1Width = l1Bytes / 2 / (windowRows * bytesPerElement) - 2 * border[lastDim];
+
+                // Multiple of 64 elements keeps tiles aligned with cache lines and vector registers
+                tileWidth = std::min(tileWidth, std::max(l1Width / 64 * 64, (int64_t)64));
+            }
+            else
+            {
+                tileWidth = std::min(tileWidth, std::max(l2Elements - 2 * border[lastDim], (int64_t)64));
+            }
+
+            tileShape.set_ith_dim(lastDim, tileWidth);
+
+            int64_t tileElements = tileWidth + 2 * border[lastDim];
+            bool innerDimsWhole = tileWidth == shape[lastDim];
+
+            // Outer dims take as much as fits in L2. Dims outside of a partial dim are not grouped (size 1).
+            for (int i = lastDim - 1; i >= 0; i--)
+            {
+                int64_t size = 1;
+
+                if (innerDimsWhole || i == lastDim - 1)
+                    size = std::clamp(l2Elements / tileElements - 2 * border[i], (int64_t)1, shape[i]);
+
+                tileShape.set_ith_dim(i, size);
+                tileElements *= size + 2 * border[i];
+                innerDimsWhole = innerDimsWhole && size == shape[i];
+            }
+
+            tileImpl(result, tileShape, startCoord, 0);
         }
 
         Region align_with_symd_len(int64_t symd_len) const
@@ -77,5 +147,27 @@ namespace symd::__internal__
 
             return Region(startCoord, endCoord.with_i(last_dim_ind, new_last_dim));
         }
+
+    private:
+
+        // Appends tiles in row-major order of tile grid.
+        void tileImpl(std::vector<Region>& result, const Dimensions& tileShape, Dimensions tileStart, int dim) const
+        {
+            for (int64_t start = startCoord[dim]; start <= endCoord[dim]; start += tileShape[dim])
+            {
+                tileStart.set_ith_dim(dim, start);
+
+                if (dim + 1 < tileShape.num_dims())
+                {
+                    tileImpl(result, tileShape, tileStart, dim + 1);
+                }
+                else
+                {
+                    auto tileEnd = (tileStart + tileShape - 1).eltwise_min(endCoord);
+                    result.push_back(Region(tileStart, tileEnd));
+                }
+            }
+        }
     };
+    } // SYMD_ISA_NAMESPACE
 }
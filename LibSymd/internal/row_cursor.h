@@ -0,0 +1,295 @@
+#pragma once
+#include <type_traits>
+#include <utility>
+#include "basic_views.h"
+#include "full_width_register.h"
+#include "sub_view.h"
+
+
+namespace symd::__internal__
+{
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
+    /// <summary>
+    /// Iterates over one row (last dimension) of a view which exposes its memory through getDataPtr.
+    /// Index math is done once per row, elements are accessed by base pointer plus offset.
+    /// </summary>
+    template <typename T>
+    struct PtrRowCursor
+    {
+        static constexpr bool supports_partial = true;
+        static constexpr bool handles_borders = true;
+
+        T* _ptr;
+        int64_t _stride;
+
+        auto fetch(int64_t i) const
+        {
+            return _ptr[i * _stride];
+        }
+
+        auto fetchVec(int64_t i) const
+        {
+            // Vector access requires densely packed last dimension.
+            assert(_stride == 1);
+            return SymdRegister<std::remove_const_t<T>>(_ptr + i);
+        }
+
+        // Loads count elements starting at i, rest of register is zero.
+        auto fetchVecPartial(int64_t i, int count) const
+        {
+            assert(_stride == 1);
+            return SymdRegister<std::remove_const_t<T>>(_ptr + i, count);
+        }
+
+        // Plain view has no border, vector can be loaded anywhere in the row.
+        auto fetchVecBorder(int64_t i) const
+        {
+            return fetchVec(i);
+        }
+
+        auto fetchVecBorderPartial(int64_t i, int count) const
+        {
+            return fetchVecPartial(i, count);
+        }
+
+        // Software prefetch of memory distance bytes after element i.
+        void prefetch(int64_t i, int64_t distance) const
+        {
+            prefetch_memory((const char*)(_ptr + i * _stride) + distance);
+        }
+
+        // Loads all lanes of full width register (maps over unsigned char, see isFullWidthMap).
+        auto fetchFull(int64_t i) const
+        {
+            assert(_stride == 1);
+            return FullWidthRegister<std::remove_const_t<T>>(_ptr + i);
+        }
+
+        auto fetchFullPartial(int64_t i, int count) const
+        {
+            assert(_stride == 1);
+            return FullWidthRegister<std::remove_const_t<T>>(_ptr + i, count);
+        }
+
+        template <typename DataType>
+        void save(int64_t i, const DataType& element)
+        {
+            _ptr[i * _stride] = element;
+        }
+
+        template <typename DataType>
+        void saveVec(int64_t i, const SymdRegister<DataType>& element)
+        {
+            assert(_stride == 1);
+            element.store(_ptr + i);
+        }
+
+        template <typename DataType>
+        void saveVecPartial(int64_t i, const SymdRegister<DataType>& element, int count)
+        {
+            assert(_stride == 1);
+            element.store(_ptr + i, count);
+        }
+
+        template <typename DataType>
+        void saveVec(int64_t i, const FullWidthRegister<DataType>& element)
+        {
+            assert(_stride == 1);
+            element.store(_ptr + i);
+        }
+
+        template <typename DataType>
+        void saveVecPartial(int64_t i, const FullWidthRegister<DataType>& element, int count)
+        {
+            assert(_stride == 1);
+            element.store(_ptr + i, count);
+        }
+    };
+
+    /// <summary>
+    /// Row cursor of symd::Tensor. Tensor rows start at 64 byte boundary, so rows which are not moved by sub_view
+    /// can be processed with aligned loads and stores.
+    /// </summary>
+    template <typename T>
+    struct AlignedRowCursor : PtrRowCursor<T>
+    {
+        bool isAligned() const
+        {
+            return this->_stride == 1 && (uintptr_t)this->_ptr % symd_alignment<std::remove_const_t<T>> == 0;
+        }
+
+        auto fetchVecAligned(int64_t i) const
+        {
+            return SymdRegister<std::remove_const_t<T>>::load_aligned(this->_ptr + i);
+        }
+
+        template <typename DataType>
+        void saveVecAligned(int64_t i, const SymdRegister<DataType>& element)
+        {
+            element.store_aligned(this->_ptr + i);
+        }
+    };
+
+    template <typename Cursor>
+    constexpr bool isAlignedCursor = false;
+
+    template <typename T>
+    constexpr bool isAlignedCursor<AlignedRowCursor<T>> = true;
+
+    /// <summary>
+    /// True if all views of map are tensors or pooled buffers, see AlignedRowCursor.
+    /// </summary>
+    template <typename OutCursor, typename... InCursors>
+    constexpr bool isAlignedMap = isAlignedCursor<OutCursor> && (isAlignedCursor<InCursors> && ...);
+
+    template <typename Cursor>
+    constexpr bool isByteCursor = false;
+
+    template <typename T>
+    constexpr bool isByteCursor<PtrRowCursor<T>> = std::is_same_v<std::remove_const_t<T>, unsigned char>;
+
+    template <typename T>
+    constexpr bool isByteCursor<AlignedRowCursor<T>> = std::is_same_v<std::remove_const_t<T>, unsigned char>;
+
+    // Output cursor of views::full_width, see full_width_view.h.
+    template <typename Cursor>
+    constexpr bool isFullWidthCursor = false;
+
+    /// <summary>
+    /// True if output opted in full width registers (views::full_width) and all inputs are unsigned char memory.
+    /// Such maps pass FullWidthRegister to kernel, which processes symd_len<unsigned char> elements (32 with AVX2)
+    /// instead of SYMD_LEN.
+    /// </summary>
+    template <typename OutCursor, typename... InCursors>
+    constexpr bool isFullWidthMap = sizeof...(InCursors) > 0 && isFullWidthCursor<OutCursor> && (isByteCursor<InCursors> && ...);
+
+    /// <summary>
+    /// Iterates over one row of a view which can only be accessed by coordinates (stencils, reductions, custom views).
+    /// </summary>
+    template <typename View>
+    struct CoordRowCursor
+    {
+        static constexpr bool supports_partial = false;
+        static constexpr bool handles_borders = false;
+
+        View* _view;
+        Dimensions _coords;
+        int _lastDim;
+        int64_t _rowStart;  // Row of sub_view does not have to start at 0
+
+        auto fetch(int64_t i)
+        {
+            _coords.set_ith_dim(_lastDim, _rowStart + i);
+            return fetchData(*_view, _coords);
+        }
+
+        auto fetchVec(int64_t i)
+        {
+            _coords.set_ith_dim(_lastDim, _rowStart + i);
+            return fetchVecData(*_view, _coords);
+        }
+
+        // Memory layout of view is unknown, nothing to prefetch.
+        void prefetch(int64_t, int64_t) const
+        {
+        }
+
+        template <typename DataType>
+        void save(int64_t i, const DataType& element)
+        {
+            _coords.set_ith_dim(_lastDim, _rowStart + i);
+            saveData(*_view, element, _coords);
+        }
+
+        template <typename DataType>
+        void saveVec(int64_t i, const DataType& element)
+        {
+            _coords.set_ith_dim(_lastDim, _rowStart + i);
+            saveVecData(*_view, element, _coords);
+        }
+    };
+
+    template <typename View, typename = void>
+    struct HasDataPtr : std::false_type
+    {
+    };
+
+    template <typename View>
+    struct HasDataPtr<View, std::void_t<decltype(getDataPtr(std::declval<View&>(), std::declval<const Dimensions&>()))>>
+        : std::true_type
+    {
+    };
+
+    /// <summary>
+    /// Creates cursor for row of view starting at rowCoords (last coordinate should be 0).
+    /// </summary>
+    template <typename View>
+    auto rowCursor(View& view, const Dimensions& rowCoords)
+    {
+        if constexpr (HasDataPtr<View>::value)
+        {
+            auto* ptr = getDataPtr(view, rowCoords);
+            return PtrRowCursor<std::remove_reference_t<decltype(*ptr)>>{ ptr, getPitch(view)[-1] };
+        }
+        else
+        {
+            return CoordRowCursor<View>{ &view, rowCoords, rowCoords.num_dims() - 1, rowCoords[-1] };
+        }
+    }
+
+    /// <summary>
+    /// Returns true if all elements of view can be traversed as one flat row.
+    /// </summary>
+    template <typename View>
+    bool isDense(const View& view)
+    {
+        if constexpr (HasDataPtr<const View>::value)
+            return getShape(view).is_native_pitch(getPitch(view));
+        else
+            return false;
+    }
+
+    /// <summary>
+    /// Size of one element of view in memory. Views without memory (reductions, generated data) have size 0.
+    /// </summary>
+    template <typename View>
+    constexpr int64_t elementSize(const View& view)
+    {
+        if constexpr (HasDataPtr<const View>::value)
+            return sizeof(std::remove_reference_t<decltype(*getDataPtr(view, std::declval<const Dimensions&>()))>);
+        else
+            return 0;
+    }
+
+    /// <summary>
+    /// Tensor rows are aligned, cursor can use aligned loads and stores (see AlignedRowCursor).
+    /// </summary>
+    template <typename T>
+    auto rowCursor(Tensor<T>& t, const Dimensions& rowCoords)
+    {
+        return AlignedRowCursor<T>{ { getDataPtr(t, rowCoords), 1 } };
+    }
+
+    template <typename T>
+    auto rowCursor(const Tensor<T>& t, const Dimensions& rowCoords)
+    {
+        return AlignedRowCursor<const T>{ { getDataPtr(t, rowCoords), 1 } };
+    }
+    /// <summary>
+    /// Row cursor of sub_view is row cursor of underlying view moved to sub_view start.
+    /// </summary>
+    template <typename View>
+    auto rowCursor(SubView<View>& subView, const Dimensions& rowCoords)
+    {
+        return rowCursor(subView._underlyingView, subView._region.startCoord + rowCoords);
+    }
+
+    template <typename View>
+    auto rowCursor(const SubView<View>& subView, const Dimensions& rowCoords)
+    {
+        return rowCursor(subView._underlyingView, subView._region.startCoord + rowCoords);
+    }
+    } // SYMD_ISA_NAMESPACE
+}
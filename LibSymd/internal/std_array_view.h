@@ -14,7 +14,7 @@ namespace symd::__internal__
     }
 
     template <typename T, std::size_t N>
-    Dimensions getPitch(const std::array<T, N>& x, typename UnderlyingRegister<T>::Type* = 0)
+    Dimensions getPitch(const std::array<T, N>&, typename UnderlyingRegister<T>::Type* = 0)
     {
         return Dimensions({ 1 });
     }
@@ -23,7 +23,7 @@ namespace symd::__internal__
     T* getDataPtr(std::array<T, N>& x, const Dimensions& coords, typename UnderlyingRegister<T>::Type* = 0)
     {
         assert(coords.num_dims() == 1);
-        assert(coords[0] < N);
+        assert(coords[0] < (int64_t)N);
 
         return x.data() + coords[0];
     }
@@ -32,7 +32,7 @@ namespace symd::__internal__
     const T* getDataPtr(const std::array<T, N>& x, const Dimensions& coords, typename UnderlyingRegister<T>::Type* = 0)
     {
         assert(coords.num_dims() == 1);
-        assert(coords[0] < N);
+        assert(coords[0] < (int64_t)N);
 
         return x.data() + coords[0];
     }
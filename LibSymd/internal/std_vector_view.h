@@ -19,7 +19,7 @@ namespace symd::__internal__
     /// Gets the pitch of vector with fundamental data types.
     /// </summary>
     template <typename T>
-    Dimensions getPitch(const std::vector<T>& x, typename UnderlyingRegister<T>::Type* = 0)
+    Dimensions getPitch(const std::vector<T>&, typename UnderlyingRegister<T>::Type* = 0)
     {
         return Dimensions({ 1 });
     }
@@ -28,7 +28,7 @@ namespace symd::__internal__
     T* getDataPtr(std::vector<T, std::allocator<T>>& x, const Dimensions& coords, typename UnderlyingRegister<T>::Type* = 0)
     {
         assert(coords.num_dims() == 1);
-        assert(coords[0] < x.size());
+        assert(coords[0] < (int64_t)x.size());
 
         return x.data() + coords[0];
     }
@@ -37,7 +37,7 @@ namespace symd::__internal__
     const T* getDataPtr(const std::vector<T, std::allocator<T>>& x, const Dimensions& coords, typename UnderlyingRegister<T>::Type* = 0)
     {
         assert(coords.num_dims() == 1);
-        assert(coords[0] < x.size());
+        assert(coords[0] < (int64_t)x.size());
 
         return x.data() + coords[0];
     }
@@ -1,10 +1,16 @@
 #pragma once
+#include <array>
+#include <algorithm>
 #include "basic_views.h"
+#include "row_cursor.h"
 #include "../dimensions.h"
 
 
 namespace symd
 {
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
     /// <summary>
     /// Specifies how accesses outside of underlying view are hendled.
     /// </summary>
@@ -15,10 +21,14 @@ namespace symd
         mirror,
         mirror_replicate
     };
+    } // SYMD_ISA_NAMESPACE
 }
 
 namespace symd::__internal__
 {
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
     template <typename View, typename C>
     struct Stencil
     {
@@ -37,6 +47,38 @@ namespace symd::__internal__
         }
     };
 
+    /// <summary>
+    /// Maps coordinate c of dimension with given size inside of it, same as Dimensions::mirrorCoords,
+    /// replicateCoords and replicateMirrorCoords. Returns -1 for constant border outside of dimension.
+    /// </summary>
+    template <Border BorderHandling>
+    int64_t borderCoord(int64_t c, int64_t size)
+    {
+        if (c >= 0 && c < size)
+            return c;
+
+        if constexpr (BorderHandling == Border::constant)
+            return -1;
+        else if constexpr (BorderHandling == Border::replicate)
+            return c < 0 ? 0 : size - 1;
+        else if constexpr (BorderHandling == Border::mirror)
+            return c < 0 ? -c : 2 * (size - 1) - c;
+        else
+            return c < 0 ? -c - 1 : 2 * size - 1 - c;
+    }
+
+    inline int64_t borderCoord(int64_t c, int64_t size, Border borderHandling)
+    {
+        switch (borderHandling)
+        {
+            case Border::constant:          return borderCoord<Border::constant>(c, size);
+            case Border::replicate:         return borderCoord<Border::replicate>(c, size);
+            case Border::mirror:            return borderCoord<Border::mirror>(c, size);
+            case Border::mirror_replicate:  return borderCoord<Border::mirror_replicate>(c, size);
+            default:                        return -1;
+        }
+    }
+
     /// <summary>
     /// Object to access stencil around specified data location (row, col)
     /// </summary>
@@ -44,7 +86,7 @@ namespace symd::__internal__
     class StencilPix
     {
         const View& _underlyingView;
-        const Dimensions& _coords;
+        Dimensions _coords;
 
         Dimensions _underlyingShape;
 
@@ -127,7 +169,7 @@ namespace symd::__internal__
     class StencilVec
     {
         const View& _underlyingView;
-        const Dimensions& _coords;
+        Dimensions _coords;
 
     public:
         using UnderlyingDataType = std::decay_t<decltype(fetchData(_underlyingView, _coords))>;
@@ -169,6 +211,155 @@ namespace symd::__internal__
         }
     };
 
+    /// <summary>
+    /// Object to access stencil around vector of elements directly through pointer to underlying memory.
+    /// </summary>
+    template <typename T>
+    class StencilPtrVec
+    {
+        const T* _center;
+        const Dimensions& _pitch;
+
+    public:
+        StencilPtrVec(const T* center, const Dimensions& pitch)
+            : _center(center)
+            , _pitch(pitch)
+        {
+        }
+
+        SymdRegister<T> operator()(int64_t d0) const
+        {
+            assert(_pitch.num_dims() == 1);
+            return SymdRegister<T>(_center + d0);
+        }
+
+        SymdRegister<T> operator()(int64_t d0, int64_t d1) const
+        {
+            assert(_pitch.num_dims() == 2);
+            return SymdRegister<T>(_center + d0 * _pitch[0] + d1);
+        }
+
+        SymdRegister<T> operator()(int64_t d0, int64_t d1, int64_t d2) const
+        {
+            assert(_pitch.num_dims() == 3);
+            return SymdRegister<T>(_center + d0 * _pitch[0] + d1 * _pitch[1] + d2);
+        }
+
+        SymdRegister<T> operator()(int64_t d0, int64_t d1, int64_t d2, int64_t d3) const
+        {
+            assert(_pitch.num_dims() == 4);
+            return SymdRegister<T>(_center + d0 * _pitch[0] + d1 * _pitch[1] + d2 * _pitch[2] + d3);
+        }
+
+        SymdRegister<T> operator()(int64_t d0, int64_t d1, int64_t d2, int64_t d3, int64_t d4) const
+        {
+            assert(_pitch.num_dims() == 5);
+            return SymdRegister<T>(_center + d0 * _pitch[0] + d1 * _pitch[1] + d2 * _pitch[2] + d3 * _pitch[3] + d4);
+        }
+    };
+
+    /// <summary>
+    /// Object to access stencil around vector of elements near border of underlying view with accessible memory.
+    /// Rows outside of the view are remapped once per access, columns outside of the view are gathered lane by lane.
+    /// Accesses which fall inside the view are plain vector loads.
+    /// </summary>
+    template <typename RowCursor, typename T>
+    class StencilBorderVec
+    {
+        const RowCursor& _cursor;
+        int64_t _column;
+
+    public:
+        StencilBorderVec(const RowCursor& cursor, int64_t column)
+            : _cursor(cursor)
+            , _column(column)
+        {
+        }
+
+        SymdRegister<T> operator()(int64_t d0) const
+        {
+            return fetch<1>({ d0 });
+        }
+
+        SymdRegister<T> operator()(int64_t d0, int64_t d1) const
+        {
+            return fetch<2>({ d0, d1 });
+        }
+
+        SymdRegister<T> operator()(int64_t d0, int64_t d1, int64_t d2) const
+        {
+            return fetch<3>({ d0, d1, d2 });
+        }
+
+        SymdRegister<T> operator()(int64_t d0, int64_t d1, int64_t d2, int64_t d3) const
+        {
+            return fetch<4>({ d0, d1, d2, d3 });
+        }
+
+        SymdRegister<T> operator()(int64_t d0, int64_t d1, int64_t d2, int64_t d3, int64_t d4) const
+        {
+            return fetch<5>({ d0, d1, d2, d3, d4 });
+        }
+
+    private:
+        template <int N>
+        SymdRegister<T> fetch(const std::array<int64_t, N>& offsets) const
+        {
+            const auto& shape = _cursor._shape;
+            assert(shape.num_dims() == N);
+
+            const T* rowPtr = _cursor._rowPtr - _cursor._rowStart;
+
+            for (int i = 0; i < N - 1; i++)
+            {
+                int64_t coord = borderCoord(_cursor._coords[i] + offsets[i], shape[i], _cursor._borderHandling);
+
+                if (coord < 0)
+                    return SymdRegister<T>(_cursor._borderConstant);
+
+                rowPtr += (coord - _cursor._coords[i]) * _cursor._pitch[i];
+            }
+
+            int64_t firstCol = _column + offsets[N - 1];
+
+            if (firstCol >= 0 && firstCol + SYMD_LEN <= shape[N - 1])
+                return SymdRegister<T>(rowPtr + firstCol);
+
+            switch (_cursor._borderHandling)
+            {
+                case Border::constant:          return gatherLanes<Border::constant>(rowPtr, firstCol);
+                case Border::replicate:         return gatherLanes<Border::replicate>(rowPtr, firstCol);
+                case Border::mirror:            return gatherLanes<Border::mirror>(rowPtr, firstCol);
+                default:                        return gatherLanes<Border::mirror_replicate>(rowPtr, firstCol);
+            }
+        }
+
+        template <Border BorderHandling>
+        SymdRegister<T> gatherLanes(const T* rowPtr, int64_t firstCol) const
+        {
+            const int64_t width = _cursor._shape[-1];
+            T lanes[SYMD_LEN];
+
+            for (int i = 0; i < SYMD_LEN; i++)
+            {
+                int64_t col = borderCoord<BorderHandling>(firstCol + i, width);
+
+                if constexpr (BorderHandling == Border::constant)
+                {
+                    lanes[i] = col < 0 ? _cursor._borderConstant : rowPtr[col];
+                }
+                else
+                {
+                    // Lanes past end of row (partial vectors) are not stored, they only have to stay inside of row.
+                    lanes[i] = rowPtr[std::clamp(col, (int64_t)0, width - 1)];
+                }
+            }
+
+            return SymdRegister<T>(lanes);
+        }
+    };
+    } // SYMD_ISA_NAMESPACE
+
     template <typename View, typename C>
     Dimensions getShape(const Stencil<View, C>& x)
     {
@@ -181,6 +372,9 @@ namespace symd::__internal__
         return getPitch(x._underlyingView);
     }
 
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
     template <typename View, typename C>
     auto fetchData(const Stencil<View, C>& x, const Dimensions& coords)
     {
@@ -198,10 +392,133 @@ namespace symd::__internal__
     {
         return st._border + getBorder(st._underlyingView);
     }
+
+    template <typename View, typename C>
+    constexpr int64_t elementSize(const Stencil<View, C>& st)
+    {
+        return elementSize(st._underlyingView);
+    }
+    } // SYMD_ISA_NAMESPACE
+}
+
+namespace symd::__internal__
+{
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
+    /// <summary>
+    /// Row cursor of stencil over view with accessible memory. Vector accesses go through pointer to the row,
+    /// vectors near border through StencilBorderVec and remaining scalar accesses through coordinates.
+    /// </summary>
+    template <typename View, typename C, typename T>
+    struct StencilPtrRowCursor
+    {
+        static constexpr bool supports_partial = true;
+        static constexpr bool handles_borders = true;
+
+        const Stencil<View, C>* _stencil;
+        Dimensions _coords;
+        Dimensions _pitch;
+        const T* _rowPtr;
+        int64_t _rowStart;
+
+        Dimensions _shape;
+        Border _borderHandling;
+        T _borderConstant;
+
+        auto fetch(int64_t i)
+        {
+            _coords.set_ith_dim(_coords.num_dims() - 1, _rowStart + i);
+            return fetchData(*_stencil, _coords);
+        }
+
+        auto fetchVec(int64_t i) const
+        {
+            return StencilPtrVec<T>(_rowPtr + i, _pitch);
+        }
+
+        auto fetchVecBorder(int64_t i) const
+        {
+            return StencilBorderVec<StencilPtrRowCursor, T>(*this, _rowStart + i);
+        }
+
+        // Lanes past end of row are remapped inside of the view, so partial vector is a border vector.
+        auto fetchVecPartial(int64_t i, int) const
+        {
+            return fetchVecBorder(i);
+        }
+
+        auto fetchVecBorderPartial(int64_t i, int) const
+        {
+            return fetchVecBorder(i);
+        }
+
+        // Prefetches all rows of stencil window, rows outside of view are read from inside by border handling.
+        void prefetch(int64_t i, int64_t distance) const
+        {
+            int rowDim = _coords.num_dims() - 2;
+
+            if (rowDim < 0)
+            {
+                prefetch_memory((const char*)(_rowPtr + i) + distance);
+                return;
+            }
+
+            int64_t row = _coords[rowDim];
+            int64_t border = _stencil->_border[rowDim];
+
+            for (int64_t d = -border; d <= border; d++)
+            {
+                if (row + d >= 0 && row + d < _shape[rowDim])
+                    prefetch_memory((const char*)(_rowPtr + i + d * _pitch[rowDim]) + distance);
+            }
+        }
+    };
+
+    template <typename View, typename C>
+    auto stencilRowCursor(const Stencil<View, C>& st, const Dimensions& rowCoords)
+    {
+        using UnderlyingView = std::remove_reference_t<View>;
+
+        if constexpr (HasDataPtr<const UnderlyingView>::value)
+        {
+            const UnderlyingView& underlyingView = st._underlyingView;
+
+            // Vector access requires densely packed last dimension.
+            assert(getPitch(underlyingView)[-1] == 1);
+
+            const auto* rowPtr = getDataPtr(underlyingView, rowCoords);
+            using T = std::remove_const_t<std::remove_reference_t<decltype(*rowPtr)>>;
+
+            return StencilPtrRowCursor<View, C, T>{
+                &st, rowCoords, getPitch(underlyingView), rowPtr, rowCoords[-1],
+                getShape(underlyingView), st._borderHandling, static_cast<T>(st._borderConstant) };
+        }
+        else
+        {
+            return CoordRowCursor<const Stencil<View, C>>{ &st, rowCoords, rowCoords.num_dims() - 1, rowCoords[-1] };
+        }
+    }
+
+    template <typename View, typename C>
+    auto rowCursor(Stencil<View, C>& st, const Dimensions& rowCoords)
+    {
+        return stencilRowCursor(st, rowCoords);
+    }
+
+    template <typename View, typename C>
+    auto rowCursor(const Stencil<View, C>& st, const Dimensions& rowCoords)
+    {
+        return stencilRowCursor(st, rowCoords);
+    }
+    } // SYMD_ISA_NAMESPACE
 }
 
 namespace symd::views
 {
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
     /// <summary>
     /// Creates stencil view from input view, so you can access nearby elements inside kernel.
     /// </summary>
@@ -238,10 +555,14 @@ namespace symd::views
     {
         return __internal__::Stencil<View, C>(std::forward<View>(view), borders, borderHandling, borderConstant);
     }
+    } // SYMD_ISA_NAMESPACE
 }
 
 namespace symd::__internal__
 {
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
     /// <summary>
     /// Creates subview for underlying Stencil view.
     /// </summary>
@@ -250,4 +571,5 @@ namespace symd::__internal__
     {
         return stencil(sub_view(st._underlyingView, region), st._borders);
     }
+    } // SYMD_ISA_NAMESPACE
 }
@@ -6,6 +6,9 @@
 
 namespace symd::__internal__
 {
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
     template <typename View>
     struct SubView
     {
@@ -18,6 +21,7 @@ namespace symd::__internal__
         {
         }
     };
+    } // SYMD_ISA_NAMESPACE
 
     template <typename View>
     Dimensions getShape(const SubView<View>& subView)
@@ -31,6 +35,27 @@ namespace symd::__internal__
         return getPitch(subView._underlyingView);
     }
 
+    template <typename View>
+    auto getDataPtr(SubView<View>& subView, const Dimensions& coords)
+        -> decltype(getDataPtr(subView._underlyingView, coords))
+    {
+        return getDataPtr(
+            subView._underlyingView,
+            subView._region.startCoord + coords);
+    }
+
+    template <typename View>
+    auto getDataPtr(const SubView<View>& subView, const Dimensions& coords)
+        -> decltype(getDataPtr(subView._underlyingView, coords))
+    {
+        return getDataPtr(
+            subView._underlyingView,
+            subView._region.startCoord + coords);
+    }
+
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
     template <typename View>
     auto fetchData(const SubView<View>& subView, const Dimensions& coords)
     {
@@ -65,28 +90,27 @@ namespace symd::__internal__
             subView._region.startCoord + coords);
     }
 
+    /// <summary>
+    /// Border of sub_view is only the part of underlying border which falls outside of underlying view.
+    /// Sub views inside of underlying view have no border, so they can be processed with vector code only.
+    /// </summary>
     template <typename View>
     Dimensions getBorder(const SubView<View>& subView)
     {
         auto underlyingShape = getShape(subView._underlyingView);
         auto underlyingBorder = getBorder(subView._underlyingView);
 
-        return underlyingBorder;
+        auto result = underlyingBorder.zeros_like();
 
-        // auto result = underlyingBorder.zeros_like();
-
-        // for (int i = 0; i < underlyingBorder.num_dims(); i++)
-        // {
-        //     if (underlyingBorder[i] > subView._region.startCoord[i])
-        //         result.set_ith_dim(i, std::max(result[i], underlyingBorder[i] - subView._region.startCoord[i]));
-
-        //     size_t rightDistance = underlyingShape[i] - subView._region.endCoord[i] - 1;
+        for (int i = 0; i < underlyingBorder.num_dims(); i++)
+        {
+            int64_t leftDistance = subView._region.startCoord[i];
+            int64_t rightDistance = underlyingShape[i] - subView._region.endCoord[i] - 1;
 
-        //     if (underlyingBorder[i] > rightDistance)
-        //         result.set_ith_dim(i, std::max(result[i], underlyingBorder[i] - rightDistance);
-        // }
+            result.set_ith_dim(i, std::max({ (int64_t)0, underlyingBorder[i] - leftDistance, underlyingBorder[i] - rightDistance }));
+        }
 
-        // return result;
+        return result;
     }
 
     template <typename View>
@@ -94,11 +118,15 @@ namespace symd::__internal__
     {
         return __internal__::SubView<View>(std::forward<View>(view), region);
     }
+    } // SYMD_ISA_NAMESPACE
 }
 
 
 namespace symd::views
 {
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
     /// <summary>
     /// Returns sub-view of underlying view. 
     /// </summary>
@@ -110,4 +138,5 @@ namespace symd::views
     {
         return __internal__::sub_view(std::forward<View>(view), __internal__::Region(startShape, endShape));
     }
+    } // SYMD_ISA_NAMESPACE
 }
@@ -2,6 +2,10 @@
 #include <type_traits>
 #include <limits>
 #include <array>
+#include <cstring>
+#include <cstdint>
+#include <atomic>
+#include "platform.h"
 #include "../bfloat16.h"
 
 
@@ -9,19 +13,22 @@ namespace symd
 {
     namespace __internal__
     {
-        // Platform check macros
-        // https://abseil.io/docs/cpp/platforms/macros#architecture
+        inline namespace SYMD_ISA_NAMESPACE
+        {
 
-    #if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
-    #define SYMD_SSE 100
-    #include <immintrin.h>
+    #if defined SYMD_AVX512
+        constexpr int SYMD_LEN = 16;
+        constexpr bool Is_AVX512 = true;
+        constexpr bool Is_SSE = true;
+        constexpr bool Is_NEON = false;
+    #elif defined SYMD_SSE
         constexpr int SYMD_LEN = 8;
+        constexpr bool Is_AVX512 = false;
         constexpr bool Is_SSE = true;
         constexpr bool Is_NEON = false;
-    #elif defined(_M_ARM64) || defined(_M_ARM) || defined(__aarch64__) || defined (__arm__)
-    #define SYMD_NEON 100
-    #include <arm_neon.h>
+    #elif defined SYMD_NEON
         constexpr int SYMD_LEN = 4;
+        constexpr bool Is_AVX512 = false;
         constexpr bool Is_SSE = false;
         constexpr bool Is_NEON = true;
     #endif
@@ -43,7 +50,9 @@ namespace symd
         {
         public:
 
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+            using Type = __m512;
+    #elif defined SYMD_SSE
             using Type = __m256;
     #elif defined SYMD_NEON
             using Type = float32x4_t;
@@ -62,7 +71,9 @@ namespace symd
         {
         public:
 
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+            using Type = __m512;
+    #elif defined SYMD_SSE
             using Type = __m256;
     #elif defined SYMD_NEON
             using Type = float32x4_t;
@@ -81,7 +92,9 @@ namespace symd
         {
         public:
 
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+            using Type = __m512i;
+    #elif defined SYMD_SSE
             using Type = __m256i;
     #elif defined SYMD_NEON
             using Type = int32x4_t; // Neon has 4 elements
@@ -101,7 +114,7 @@ namespace symd
         public:
 
     #ifdef SYMD_SSE
-            using Type = __m128i;
+            using Type = __m128i; // 8 elements used with AVX2, all 16 with AVX-512
     #elif defined SYMD_NEON
             using Type = uint8x8_t; // Neon has 4 elements
     #endif
@@ -115,12 +128,58 @@ namespace symd
         };
 
 
+        template <>
+        class UnderlyingRegister<int16_t>
+        {
+        public:
+
+    #ifdef SYMD_AVX512
+            using Type = __m256i;
+    #elif defined SYMD_SSE
+            using Type = __m128i;
+    #elif defined SYMD_NEON
+            using Type = int16x4_t;
+    #endif
+
+            using DType = int16_t;
+
+            constexpr static bool is_supported_type()
+            {
+                return true;
+            }
+        };
+
+
+        template <>
+        class UnderlyingRegister<uint16_t>
+        {
+        public:
+
+    #ifdef SYMD_AVX512
+            using Type = __m256i;
+    #elif defined SYMD_SSE
+            using Type = __m128i;
+    #elif defined SYMD_NEON
+            using Type = uint16x4_t;
+    #endif
+
+            using DType = uint16_t;
+
+            constexpr static bool is_supported_type()
+            {
+                return true;
+            }
+        };
+
+
         template <>
         class UnderlyingRegister<double>
         {
         public:
 
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+            using Type = std::array<__m512d, 2>;
+    #elif defined SYMD_SSE
             using Type = std::array<__m256d, 2>;
     #elif defined SYMD_NEON
             using Type = std::array<float64x2_t, 2>; // Neon has 4 elements
@@ -141,6 +200,54 @@ namespace symd
             static_assert(UnderlyingRegister<T>::is_supported_type(), "Unsuported Symd type");
         }
 
+        // int16_t and uint16_t share most of implementation. Only comparisons, min, max, right shift
+        // and conversions depend on sign.
+        template <typename T>
+        constexpr bool is_16bit_int = std::is_same_v<T, int16_t> || std::is_same_v<T, uint16_t>;
+
+        // Operations which can be used to combine elements of one register (see SymdRegister::hsum, hmin...).
+        enum class HorizontalOp
+        {
+            add,
+            mul,
+            min,
+            max,
+            bit_and,
+            bit_or
+        };
+
+        /// <summary>
+        /// Alignment required by SymdRegister<T>::load_aligned and store_aligned. Registers larger than 64 bytes
+        /// (double with AVX512) are two hardware registers, each of them needs 64 bytes.
+        /// </summary>
+        template <typename T>
+        constexpr size_t symd_alignment = SYMD_LEN * sizeof(T) < 64 ? SYMD_LEN * sizeof(T) : 64;
+
+        /// <summary>
+        /// Orders non-temporal stores (store_stream) before all later stores, so their results are visible to
+        /// other threads.
+        /// </summary>
+        inline void stream_fence()
+        {
+    #if defined SYMD_AVX512 || defined SYMD_SSE
+            _mm_sfence();
+    #elif defined SYMD_NEON
+            std::atomic_thread_fence(std::memory_order_release);
+    #endif
+        }
+
+        /// <summary>
+        /// Hints CPU to load cache line with ptr to all cache levels. Never faults, ptr may point past end of data.
+        /// </summary>
+        inline void prefetch_memory(const void* ptr)
+        {
+    #if defined SYMD_AVX512 || defined SYMD_SSE
+            _mm_prefetch((const char*)ptr, _MM_HINT_T0);
+    #elif defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(ptr);
+    #endif
+        }
+
         ////////////////////////////////////////////////////////////////////////////////////////////////////////
         // SymdRegister class - core class for SIMD registers
         ////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -148,13 +255,270 @@ namespace symd
         template <typename T>
         class SymdRegister
         {
+            template <HorizontalOp Op, typename S>
+            static S scalar_op(S a, S b)
+            {
+                if constexpr (Op == HorizontalOp::add)
+                    return (S)(a + b);
+                else if constexpr (Op == HorizontalOp::mul)
+                    return (S)(a * b);
+                else if constexpr (Op == HorizontalOp::min)
+                    return b < a ? b : a;
+                else if constexpr (Op == HorizontalOp::max)
+                    return a < b ? b : a;
+                else if constexpr (Op == HorizontalOp::bit_and)
+                    return (S)(a & b);
+                else
+                    return (S)(a | b);
+            }
+
+            // Combines lanes one by one. Used where instruction set has no suitable instruction.
+            template <HorizontalOp Op>
+            T horizontal_lanes() const
+            {
+                auto res = _ptrToData[0];
+
+                for (int i = 1; i < SYMD_LEN; i++)
+                    res = scalar_op<Op>(res, _ptrToData[i]);
+
+                return (T)res;
+            }
+
+            // Combines all lanes with Op. Register is halved with shuffles until one lane remains.
+            template <HorizontalOp Op>
+            T horizontal() const
+            {
+                static_assert(std::is_integral_v<T> || (Op != HorizontalOp::bit_and && Op != HorizontalOp::bit_or),
+                    "Bitwise horizontal reductions are supported for integer types only.");
+
+                if constexpr (std::is_same_v<T, float> || std::is_same_v<T, symd::bfloat16>)
+                {
+    #ifdef SYMD_AVX512
+                    if constexpr (Op == HorizontalOp::add)
+                        return (T)_mm512_reduce_add_ps(_reg);
+                    else if constexpr (Op == HorizontalOp::mul)
+                        return (T)_mm512_reduce_mul_ps(_reg);
+                    else if constexpr (Op == HorizontalOp::min)
+                        return (T)_mm512_reduce_min_ps(_reg);
+                    else
+                        return (T)_mm512_reduce_max_ps(_reg);
+    #elif defined SYMD_SSE
+                    auto op = [](__m128 a, __m128 b)
+                    {
+                        if constexpr (Op == HorizontalOp::add)
+                            return _mm_add_ps(a, b);
+                        else if constexpr (Op == HorizontalOp::mul)
+                            return _mm_mul_ps(a, b);
+                        else if constexpr (Op == HorizontalOp::min)
+                            return _mm_min_ps(a, b);
+                        else
+                            return _mm_max_ps(a, b);
+                    };
+
+                    __m128 v = op(_mm256_castps256_ps128(_reg), _mm256_extractf128_ps(_reg, 1));
+                    v = op(v, _mm_movehl_ps(v, v));
+                    v = op(v, _mm_shuffle_ps(v, v, 1));
+                    return (T)_mm_cvtss_f32(v);
+    #elif defined SYMD_NEON
+                    if constexpr (Op == HorizontalOp::add)
+                        return (T)vaddvq_f32(_reg);
+                    else if constexpr (Op == HorizontalOp::min)
+                        return (T)vminvq_f32(_reg);
+                    else if constexpr (Op == HorizontalOp::max)
+                        return (T)vmaxvq_f32(_reg);
+                    else
+                    {
+                        float32x2_t v = vmul_f32(vget_low_f32(_reg), vget_high_f32(_reg));
+                        return (T)(vget_lane_f32(v, 0) * vget_lane_f32(v, 1));
+                    }
+    #endif
+                }
+                else if constexpr (std::is_same_v<T, int>)
+                {
+    #ifdef SYMD_AVX512
+                    if constexpr (Op == HorizontalOp::add)
+                        return _mm512_reduce_add_epi32(_reg);
+                    else if constexpr (Op == HorizontalOp::mul)
+                        return _mm512_reduce_mul_epi32(_reg);
+                    else if constexpr (Op == HorizontalOp::min)
+                        return _mm512_reduce_min_epi32(_reg);
+                    else if constexpr (Op == HorizontalOp::max)
+                        return _mm512_reduce_max_epi32(_reg);
+                    else if constexpr (Op == HorizontalOp::bit_and)
+                        return _mm512_reduce_and_epi32(_reg);
+                    else
+                        return _mm512_reduce_or_epi32(_reg);
+    #elif defined SYMD_SSE
+                    auto op = [](__m128i a, __m128i b)
+                    {
+                        if constexpr (Op == HorizontalOp::add)
+                            return _mm_add_epi32(a, b);
+                        else if constexpr (Op == HorizontalOp::mul)
+                            return _mm_mullo_epi32(a, b);
+                        else if constexpr (Op == HorizontalOp::min)
+                            return _mm_min_epi32(a, b);
+                        else if constexpr (Op == HorizontalOp::max)
+                            return _mm_max_epi32(a, b);
+                        else if constexpr (Op == HorizontalOp::bit_and)
+                            return _mm_and_si128(a, b);
+                        else
+                            return _mm_or_si128(a, b);
+                    };
+
+                    __m128i v = op(_mm256_castsi256_si128(_reg), _mm256_extracti128_si256(_reg, 1));
+                    v = op(v, _mm_unpackhi_epi64(v, v));
+                    v = op(v, _mm_shuffle_epi32(v, 1));
+                    return _mm_cvtsi128_si32(v);
+    #elif defined SYMD_NEON
+                    if constexpr (Op == HorizontalOp::add)
+                        return vaddvq_s32(_reg);
+                    else if constexpr (Op == HorizontalOp::min)
+                        return vminvq_s32(_reg);
+                    else if constexpr (Op == HorizontalOp::max)
+                        return vmaxvq_s32(_reg);
+                    else
+                        return horizontal_lanes<Op>();
+    #endif
+                }
+                else if constexpr (std::is_same_v<T, unsigned char>)
+                {
+    #ifdef SYMD_SSE
+                    if constexpr (Op == HorizontalOp::mul)
+                    {
+                        // No 8 bit multiplication
+                        return horizontal_lanes<Op>();
+                    }
+                    else
+                    {
+                        auto op = [](__m128i a, __m128i b)
+                        {
+                            if constexpr (Op == HorizontalOp::add)
+                                return _mm_add_epi8(a, b);
+                            else if constexpr (Op == HorizontalOp::min)
+                                return _mm_min_epu8(a, b);
+                            else if constexpr (Op == HorizontalOp::max)
+                                return _mm_max_epu8(a, b);
+                            else if constexpr (Op == HorizontalOp::bit_and)
+                                return _mm_and_si128(a, b);
+                            else
+                                return _mm_or_si128(a, b);
+                        };
+
+                        // Only first SYMD_LEN bytes are elements of register
+                        __m128i v = _reg;
+
+                        if constexpr (SYMD_LEN == 16)
+                            v = op(v, _mm_srli_si128(v, 8));
+
+                        v = op(v, _mm_srli_si128(v, 4));
+                        v = op(v, _mm_srli_si128(v, 2));
+                        v = op(v, _mm_srli_si128(v, 1));
+                        return (unsigned char)_mm_cvtsi128_si32(v);
+                    }
+    #elif defined SYMD_NEON
+                    return horizontal_lanes<Op>();
+    #endif
+                }
+                else if constexpr (is_16bit_int<T>)
+                {
+    #ifdef SYMD_SSE
+                    constexpr bool isSigned = std::is_same_v<T, int16_t>;
+
+                    auto op = [](__m128i a, __m128i b)
+                    {
+                        if constexpr (Op == HorizontalOp::add)
+                            return _mm_add_epi16(a, b);
+                        else if constexpr (Op == HorizontalOp::mul)
+                            return _mm_mullo_epi16(a, b);
+                        else if constexpr (Op == HorizontalOp::min)
+                            return isSigned ? _mm_min_epi16(a, b) : _mm_min_epu16(a, b);
+                        else if constexpr (Op == HorizontalOp::max)
+                            return isSigned ? _mm_max_epi16(a, b) : _mm_max_epu16(a, b);
+                        else if constexpr (Op == HorizontalOp::bit_and)
+                            return _mm_and_si128(a, b);
+                        else
+                            return _mm_or_si128(a, b);
+                    };
+
+        #ifdef SYMD_AVX512
+                    __m128i v = op(_mm256_castsi256_si128(_reg), _mm256_extracti128_si256(_reg, 1));
+        #else
+                    __m128i v = _reg;
+        #endif
+                    v = op(v, _mm_srli_si128(v, 8));
+                    v = op(v, _mm_srli_si128(v, 4));
+                    v = op(v, _mm_srli_si128(v, 2));
+                    return (T)_mm_cvtsi128_si32(v);
+    #elif defined SYMD_NEON
+                    return horizontal_lanes<Op>();
+    #endif
+                }
+                else if constexpr (std::is_same_v<T, double>)
+                {
+    #ifdef SYMD_AVX512
+                    if constexpr (Op == HorizontalOp::add)
+                        return _mm512_reduce_add_pd(_mm512_add_pd(_reg[0], _reg[1]));
+                    else if constexpr (Op == HorizontalOp::mul)
+                        return _mm512_reduce_mul_pd(_mm512_mul_pd(_reg[0], _reg[1]));
+                    else if constexpr (Op == HorizontalOp::min)
+                        return _mm512_reduce_min_pd(_mm512_min_pd(_reg[0], _reg[1]));
+                    else
+                        return _mm512_reduce_max_pd(_mm512_max_pd(_reg[0], _reg[1]));
+    #elif defined SYMD_SSE
+                    __m256d d;
+                    __m128d v;
+
+                    if constexpr (Op == HorizontalOp::add)
+                    {
+                        d = _mm256_add_pd(_reg[0], _reg[1]);
+                        v = _mm_add_pd(_mm256_castpd256_pd128(d), _mm256_extractf128_pd(d, 1));
+                        v = _mm_add_sd(v, _mm_unpackhi_pd(v, v));
+                    }
+                    else if constexpr (Op == HorizontalOp::mul)
+                    {
+                        d = _mm256_mul_pd(_reg[0], _reg[1]);
+                        v = _mm_mul_pd(_mm256_castpd256_pd128(d), _mm256_extractf128_pd(d, 1));
+                        v = _mm_mul_sd(v, _mm_unpackhi_pd(v, v));
+                    }
+                    else if constexpr (Op == HorizontalOp::min)
+                    {
+                        d = _mm256_min_pd(_reg[0], _reg[1]);
+                        v = _mm_min_pd(_mm256_castpd256_pd128(d), _mm256_extractf128_pd(d, 1));
+                        v = _mm_min_sd(v, _mm_unpackhi_pd(v, v));
+                    }
+                    else
+                    {
+                        d = _mm256_max_pd(_reg[0], _reg[1]);
+                        v = _mm_max_pd(_mm256_castpd256_pd128(d), _mm256_extractf128_pd(d, 1));
+                        v = _mm_max_sd(v, _mm_unpackhi_pd(v, v));
+                    }
+
+                    return _mm_cvtsd_f64(v);
+    #elif defined SYMD_NEON
+                    if constexpr (Op == HorizontalOp::add)
+                        return vaddvq_f64(vaddq_f64(_reg[0], _reg[1]));
+                    else if constexpr (Op == HorizontalOp::min)
+                        return vminvq_f64(vminq_f64(_reg[0], _reg[1]));
+                    else if constexpr (Op == HorizontalOp::max)
+                        return vmaxvq_f64(vmaxq_f64(_reg[0], _reg[1]));
+                    else
+                    {
+                        float64x2_t v = vmulq_f64(_reg[0], _reg[1]);
+                        return vgetq_lane_f64(v, 0) * vgetq_lane_f64(v, 1);
+                    }
+    #endif
+                }
+            }
+
             void construct_from_scalar(T other)
             {
                 assert_supported_type<T>();
 
                 if constexpr (std::is_same_v<T, float>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    _reg = _mm512_set1_ps(other);
+    #elif defined SYMD_SSE
                     _reg = _mm256_set1_ps(other);
     #elif defined SYMD_NEON
                     _reg = vdupq_n_f32(other);
@@ -162,7 +526,9 @@ namespace symd
                 }
                 else if constexpr (std::is_same_v<T, symd::bfloat16>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    _reg = _mm512_set1_ps((float)other);
+    #elif defined SYMD_SSE
                     _reg = _mm256_set1_ps((float)other);
     #elif defined SYMD_NEON
                     _reg = vld1q_f32((float)other);
@@ -170,7 +536,9 @@ namespace symd
                 }
                 else if constexpr (std::is_same_v<T, int>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    _reg = _mm512_set1_epi32(other);
+    #elif defined SYMD_SSE
                     _reg = _mm256_set1_epi32(other);
     #elif defined SYMD_NEON
                     _reg = vdupq_n_s32(x);
@@ -182,11 +550,27 @@ namespace symd
                     _reg = _mm_set1_epi8(other);
     #elif defined SYMD_NEON
                     _reg = vdup_n_u8(other);
+    #endif
+                }
+                else if constexpr (is_16bit_int<T>)
+                {
+    #ifdef SYMD_AVX512
+                    _reg = _mm256_set1_epi16((short)other);
+    #elif defined SYMD_SSE
+                    _reg = _mm_set1_epi16((short)other);
+    #elif defined SYMD_NEON
+                    if constexpr (std::is_same_v<T, int16_t>)
+                        _reg = vdup_n_s16(other);
+                    else
+                        _reg = vdup_n_u16(other);
     #endif
                 }
                 else if constexpr (std::is_same_v<T, double>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    _reg[0] = _mm512_set1_pd(other);
+
+    #elif defined SYMD_SSE
                     _reg[0] = _mm256_set1_pd(other);
 
     #elif defined SYMD_NEON
@@ -233,7 +617,9 @@ namespace symd
 
                 if constexpr (std::is_same_v<T, float>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    _reg = _mm512_loadu_ps(ptr);
+    #elif defined SYMD_SSE
                     _reg = _mm256_loadu_ps(ptr);
     #elif defined SYMD_NEON
                     _reg = vld1q_f32(ptr);
@@ -242,7 +628,12 @@ namespace symd
                 else if constexpr (std::is_same_v<T, symd::bfloat16>)
                 {
                     
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    // bfloat16 is upper half of float
+                    __m256i sixteen_shorts = _mm256_loadu_si256((__m256i*)ptr);
+                    _reg = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(sixteen_shorts), 16));
+
+    #elif defined SYMD_SSE
                     __m128i eight_shorts = _mm_loadu_si128((__m128i*)ptr);
                     __m128i zeros = _mm_setzero_si128();
 
@@ -259,7 +650,9 @@ namespace symd
                 }
                 else if constexpr (std::is_same_v<T, int>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    _reg = _mm512_loadu_si512(ptr);
+    #elif defined SYMD_SSE
                     _reg = _mm256_loadu_si256((__m256i*)ptr);
     #elif defined SYMD_NEON
                     _reg = vld1q_s32(ptr);
@@ -267,15 +660,33 @@ namespace symd
                 }
                 else if constexpr (std::is_same_v<T, unsigned char>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    _reg = _mm_loadu_si128((__m128i*)ptr);
+    #elif defined SYMD_SSE
                     _reg = _mm_loadu_si64((__m128i*)ptr);
     #elif defined SYMD_NEON
                     _reg = vld1q_s32(ptr);
+    #endif
+                }
+                else if constexpr (is_16bit_int<T>)
+                {
+    #ifdef SYMD_AVX512
+                    _reg = _mm256_loadu_si256((__m256i*)ptr);
+    #elif defined SYMD_SSE
+                    _reg = _mm_loadu_si128((__m128i*)ptr);
+    #elif defined SYMD_NEON
+                    if constexpr (std::is_same_v<T, int16_t>)
+                        _reg = vld1_s16(ptr);
+                    else
+                        _reg = vld1_u16(ptr);
     #endif
                 }
                 else if constexpr (std::is_same_v<T, double>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    _reg[0] = _mm512_loadu_pd(ptr + 0);
+                    _reg[1] = _mm512_loadu_pd(ptr + 8);
+    #elif defined SYMD_SSE
                     _reg[0] = _mm256_loadu_pd(ptr + 0);
                     _reg[1] = _mm256_loadu_pd(ptr + 4);
     #elif defined SYMD_NEON
@@ -285,6 +696,236 @@ namespace symd
                 }
             }
 
+            // Reads first count elements from memory, remaining elements are set to zero.
+            // Does not touch memory after ptr + count, so it can be used for row tails.
+            SymdRegister(const T* ptr, int count)
+            {
+                assert_supported_type<T>();
+                assert(count >= 0 && count <= SYMD_LEN);
+
+    #ifdef SYMD_AVX512
+                __mmask16 mask = _first_lanes_kmask(count);
+
+                if constexpr (std::is_same_v<T, float>)
+                {
+                    _reg = _mm512_maskz_loadu_ps(mask, ptr);
+                }
+                else if constexpr (std::is_same_v<T, symd::bfloat16>)
+                {
+                    __m256i shorts = _mm256_maskz_loadu_epi16(mask, ptr);
+                    _reg = _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(shorts), 16));
+                }
+                else if constexpr (std::is_same_v<T, int>)
+                {
+                    _reg = _mm512_maskz_loadu_epi32(mask, ptr);
+                }
+                else if constexpr (std::is_same_v<T, double>)
+                {
+                    _reg[0] = _mm512_maskz_loadu_pd((__mmask8)mask, ptr + 0);
+                    _reg[1] = _mm512_maskz_loadu_pd((__mmask8)(mask >> 8), ptr + 8);
+                }
+                else if constexpr (std::is_same_v<T, unsigned char>)
+                {
+                    _reg = _mm_maskz_loadu_epi8(mask, ptr);
+                }
+                else if constexpr (is_16bit_int<T>)
+                {
+                    _reg = _mm256_maskz_loadu_epi16(mask, ptr);
+                }
+                else
+    #elif defined SYMD_SSE
+                if constexpr (std::is_same_v<T, float>)
+                {
+                    _reg = _mm256_maskload_ps(ptr, first_lanes_mask(count)._int_mask());
+                }
+                else if constexpr (std::is_same_v<T, int>)
+                {
+                    _reg = _mm256_maskload_epi32(ptr, first_lanes_mask(count)._reg);
+                }
+                else if constexpr (std::is_same_v<T, double>)
+                {
+                    auto mask = first_lanes_mask(count);
+
+                    _reg[0] = _mm256_maskload_pd(ptr + 0, _mm256_castpd_si256(mask._reg[0]));
+                    _reg[1] = _mm256_maskload_pd(ptr + 4, _mm256_castpd_si256(mask._reg[1]));
+                }
+                else
+    #endif
+                {
+                    // 8 and 16 bit types have no masked loads - go through zeroed buffer
+                    T buffer[SYMD_LEN];
+                    std::memset((void*)buffer, 0, sizeof(buffer));
+                    std::memcpy((void*)buffer, ptr, count * sizeof(T));
+
+                    *this = SymdRegister(buffer);
+                }
+            }
+
+            // Reads register from memory aligned to size of register (e.g. rows of symd::Tensor).
+            // Types which use only part of register load the same way as from unaligned memory.
+            static SymdRegister load_aligned(const T* ptr)
+            {
+                assert((uintptr_t)ptr % symd_alignment<T> == 0);
+
+                SymdRegister res;
+
+                if constexpr (std::is_same_v<T, float>)
+                {
+    #ifdef SYMD_AVX512
+                    res._reg = _mm512_load_ps(ptr);
+    #elif defined SYMD_SSE
+                    res._reg = _mm256_load_ps(ptr);
+    #elif defined SYMD_NEON
+                    res._reg = vld1q_f32(ptr);
+    #endif
+                }
+                else if constexpr (std::is_same_v<T, int>)
+                {
+    #ifdef SYMD_AVX512
+                    res._reg = _mm512_load_si512(ptr);
+    #elif defined SYMD_SSE
+                    res._reg = _mm256_load_si256((const __m256i*)ptr);
+    #elif defined SYMD_NEON
+                    res._reg = vld1q_s32(ptr);
+    #endif
+                }
+                else if constexpr (std::is_same_v<T, double>)
+                {
+    #ifdef SYMD_AVX512
+                    res._reg[0] = _mm512_load_pd(ptr + 0);
+                    res._reg[1] = _mm512_load_pd(ptr + 8);
+    #elif defined SYMD_SSE
+                    res._reg[0] = _mm256_load_pd(ptr + 0);
+                    res._reg[1] = _mm256_load_pd(ptr + 4);
+    #elif defined SYMD_NEON
+                    res._reg[0] = vld1q_f64(ptr + 0);
+                    res._reg[1] = vld1q_f64(ptr + 2);
+    #endif
+                }
+                else
+                {
+                    res = SymdRegister(ptr);
+                }
+
+                return res;
+            }
+
+            // Returns register with all bits set in first count elements and zeros in the remaining elements.
+            static SymdRegister first_lanes_mask(int count)
+            {
+                assert_supported_type<T>();
+
+    #ifdef SYMD_AVX512
+                return _from_kmask(_first_lanes_kmask(count));
+    #elif defined SYMD_SSE
+                if constexpr (std::is_same_v<T, float> || std::is_same_v<T, symd::bfloat16>)
+                {
+                    __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+                    return _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(count), lanes));
+                }
+                else if constexpr (std::is_same_v<T, int>)
+                {
+                    __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+                    return _mm256_cmpgt_epi32(_mm256_set1_epi32(count), lanes);
+                }
+                else if constexpr (std::is_same_v<T, unsigned char>)
+                {
+                    __m128i lanes = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+                    return _mm_cmpgt_epi8(_mm_set1_epi8((char)count), lanes);
+                }
+                else if constexpr (is_16bit_int<T>)
+                {
+                    __m128i lanes = _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7);
+                    return _mm_cmpgt_epi16(_mm_set1_epi16((short)count), lanes);
+                }
+                else if constexpr (std::is_same_v<T, double>)
+                {
+                    __m256i countReg = _mm256_set1_epi64x(count);
+
+                    return typename UnderlyingRegister<T>::Type{
+                        _mm256_castsi256_pd(_mm256_cmpgt_epi64(countReg, _mm256_setr_epi64x(0, 1, 2, 3))),
+                        _mm256_castsi256_pd(_mm256_cmpgt_epi64(countReg, _mm256_setr_epi64x(4, 5, 6, 7)))
+                    };
+                }
+    #elif defined SYMD_NEON
+                SymdRegister res((T)0);
+
+                for (int i = 0; i < count; i++)
+                    std::memset((void*)&res._ptrToData[i], 0xFF, sizeof(res._ptrToData[i]));
+
+                return res;
+    #endif
+            }
+
+    #ifdef SYMD_AVX512
+            // Mask with first count bits set. Used by masked loads and stores.
+            static __mmask16 _first_lanes_kmask(int count)
+            {
+                return (__mmask16)((1u << count) - 1);
+            }
+
+            // Expands AVX-512 mask register to register with all bits set in selected elements.
+            // Comparisons return full registers so they can be combined with bit operators like on other platforms.
+            static SymdRegister _from_kmask(__mmask16 mask)
+            {
+                if constexpr (std::is_same_v<T, float> || std::is_same_v<T, symd::bfloat16>)
+                {
+                    return _mm512_castsi512_ps(_mm512_movm_epi32(mask));
+                }
+                else if constexpr (std::is_same_v<T, int>)
+                {
+                    return _mm512_movm_epi32(mask);
+                }
+                else if constexpr (std::is_same_v<T, unsigned char>)
+                {
+                    return _mm_movm_epi8(mask);
+                }
+                else if constexpr (is_16bit_int<T>)
+                {
+                    return _mm256_movm_epi16(mask);
+                }
+                else if constexpr (std::is_same_v<T, double>)
+                {
+                    return typename UnderlyingRegister<T>::Type{
+                        _mm512_castsi512_pd(_mm512_movm_epi64((__mmask8)mask)),
+                        _mm512_castsi512_pd(_mm512_movm_epi64((__mmask8)(mask >> 8)))
+                    };
+                }
+            }
+
+            // Compresses register produced by comparison back to AVX-512 mask register (sign bit of each element).
+            __mmask16 _kmask() const
+            {
+                if constexpr (std::is_same_v<T, float> || std::is_same_v<T, symd::bfloat16>)
+                {
+                    return _mm512_movepi32_mask(_mm512_castps_si512(_reg));
+                }
+                else if constexpr (std::is_same_v<T, int>)
+                {
+                    return _mm512_movepi32_mask(_reg);
+                }
+                else if constexpr (std::is_same_v<T, unsigned char>)
+                {
+                    return _mm_movepi8_mask(_reg);
+                }
+                else if constexpr (is_16bit_int<T>)
+                {
+                    return _mm256_movepi16_mask(_reg);
+                }
+                else if constexpr (std::is_same_v<T, double>)
+                {
+                    return (__mmask16)(_mm512_movepi64_mask(_mm512_castpd_si512(_reg[0])) |
+                        (_mm512_movepi64_mask(_mm512_castpd_si512(_reg[1])) << 8));
+                }
+            }
+    #elif defined SYMD_SSE
+            // Reinterprets float mask register as integer register (needed by masked loads and stores).
+            __m256i _int_mask() const
+            {
+                return _mm256_castps_si256(_reg);
+            }
+    #endif
+
             // Constructs register with all elements equal to other
             SymdRegister(float other)
             {
@@ -325,7 +966,9 @@ namespace symd
 
                 if constexpr (std::is_same_v<T, float> || std::is_same_v<T, symd::bfloat16>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _mm512_add_ps(_reg, other._reg);
+    #elif defined SYMD_SSE
                     return _mm256_add_ps(_reg, other._reg);
     #elif defined SYMD_NEON
                     return vaddq_f32(_reg, other._reg),
@@ -333,7 +976,9 @@ namespace symd
                 }
                 else if constexpr (std::is_same_v<T, int>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _mm512_add_epi32(_reg, other._reg);
+    #elif defined SYMD_SSE
                     return _mm256_add_epi32(_reg, other._reg);
     #elif defined SYMD_NEON
                     return SymdRegister(vaddq_s32(_reg, other._reg));
@@ -345,12 +990,28 @@ namespace symd
                     return _mm_adds_epu8(_reg, other._reg);
     #elif defined SYMD_NEON
                     return vadd_u8(_reg, other._reg);
+    #endif
+                }
+                else if constexpr (is_16bit_int<T>)
+                {
+    #ifdef SYMD_AVX512
+                    return _mm256_add_epi16(_reg, other._reg);
+    #elif defined SYMD_SSE
+                    return _mm_add_epi16(_reg, other._reg);
+    #elif defined SYMD_NEON
+                    if constexpr (std::is_same_v<T, int16_t>)
+                        return vadd_s16(_reg, other._reg);
+                    else
+                        return vadd_u16(_reg, other._reg);
     #endif
                 }
                 else if constexpr (std::is_same_v<T, double>)
                 {
                     return SymdRegister(typename UnderlyingRegister<T>::Type {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                        _mm512_add_pd(_reg[0], other._reg[0]),
+                        _mm512_add_pd(_reg[1], other._reg[1])
+    #elif defined SYMD_SSE
                         _mm256_add_pd(_reg[0], other._reg[0]),
                         _mm256_add_pd(_reg[1], other._reg[1])
     #elif defined SYMD_NEON
@@ -365,7 +1026,9 @@ namespace symd
             {
                 if constexpr (std::is_same_v<T, float> || std::is_same_v<T, symd::bfloat16>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _mm512_sub_ps(_reg, other._reg);
+    #elif defined SYMD_SSE
                     return _mm256_sub_ps(_reg, other._reg);
     #elif defined SYMD_NEON
                     return vsubq_f32(_reg, other._reg),
@@ -373,7 +1036,9 @@ namespace symd
                 }
                 else if constexpr (std::is_same_v<T, int>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _mm512_sub_epi32(_reg, other._reg);
+    #elif defined SYMD_SSE
                     return _mm256_sub_epi32(_reg, other._reg);
     #elif defined SYMD_NEON
                     return vsubq_s32(_reg, other._reg);
@@ -385,12 +1050,28 @@ namespace symd
                     return _mm_subs_epu8(_reg, other._reg);
     #elif defined SYMD_NEON
                     return vsub_u8(_reg, other._reg);
+    #endif
+                }
+                else if constexpr (is_16bit_int<T>)
+                {
+    #ifdef SYMD_AVX512
+                    return _mm256_sub_epi16(_reg, other._reg);
+    #elif defined SYMD_SSE
+                    return _mm_sub_epi16(_reg, other._reg);
+    #elif defined SYMD_NEON
+                    if constexpr (std::is_same_v<T, int16_t>)
+                        return vsub_s16(_reg, other._reg);
+                    else
+                        return vsub_u16(_reg, other._reg);
     #endif
                 }
                 else if constexpr (std::is_same_v<T, double>)
                 {
                     return typename UnderlyingRegister<T>::Type {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                        _mm512_sub_pd(_reg[0], other._reg[0]),
+                        _mm512_sub_pd(_reg[1], other._reg[1])
+    #elif defined SYMD_SSE
                         _mm256_sub_pd(_reg[0], other._reg[0]),
                         _mm256_sub_pd(_reg[1], other._reg[1])
     #elif defined SYMD_NEON
@@ -407,7 +1088,9 @@ namespace symd
 
                 if constexpr (std::is_same_v<T, float> || std::is_same_v<T, symd::bfloat16>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _mm512_mul_ps(_reg, other._reg);
+    #elif defined SYMD_SSE
                     return _mm256_mul_ps(_reg, other._reg);
     #elif defined SYMD_NEON
                     return vmulq_f32(_reg, other._reg);
@@ -415,16 +1098,34 @@ namespace symd
                 }
                 else if constexpr (std::is_same_v<T, int>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _mm512_mullo_epi32(_reg, other._reg);
+    #elif defined SYMD_SSE
                     return _mm256_mullo_epi32(_reg, other._reg);
     #elif defined SYMD_NEON
                     return vmulq_s32(_reg, other._reg);
+    #endif
+                }
+                else if constexpr (is_16bit_int<T>)
+                {
+    #ifdef SYMD_AVX512
+                    return _mm256_mullo_epi16(_reg, other._reg);
+    #elif defined SYMD_SSE
+                    return _mm_mullo_epi16(_reg, other._reg);
+    #elif defined SYMD_NEON
+                    if constexpr (std::is_same_v<T, int16_t>)
+                        return vmul_s16(_reg, other._reg);
+                    else
+                        return vmul_u16(_reg, other._reg);
     #endif
                 }
                 else if constexpr (std::is_same_v<T, double>)
                 {
                     return typename UnderlyingRegister<T>::Type{
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                        _mm512_mul_pd(_reg[0], other._reg[0]),
+                        _mm512_mul_pd(_reg[1], other._reg[1])
+    #elif defined SYMD_SSE
                         _mm256_mul_pd(_reg[0], other._reg[0]),
                         _mm256_mul_pd(_reg[1], other._reg[1])
     #elif defined SYMD_NEON
@@ -435,14 +1136,173 @@ namespace symd
                 }
             }
 
+            // Computes this * b + c. Uses fused multiply-add (single rounding) when available.
+            SymdRegister fmadd(const SymdRegister<T>& b, const SymdRegister<T>& c) const
+            {
+                static_assert(!std::is_same_v<T, unsigned char>, "Multiplication not supported for unsigned char. Convert to other type.");
+
+                if constexpr (std::is_same_v<T, float> || std::is_same_v<T, symd::bfloat16>)
+                {
+    #ifdef SYMD_AVX512
+                    return _mm512_fmadd_ps(_reg, b._reg, c._reg);
+    #elif defined(SYMD_SSE) && defined(SYMD_FMA)
+                    return _mm256_fmadd_ps(_reg, b._reg, c._reg);
+    #elif defined SYMD_NEON
+                    return vfmaq_f32(c._reg, _reg, b._reg);
+    #else
+                    return *this * b + c;
+    #endif
+                }
+                else if constexpr (std::is_same_v<T, double>)
+                {
+    #ifdef SYMD_AVX512
+                    return typename UnderlyingRegister<T>::Type{
+                        _mm512_fmadd_pd(_reg[0], b._reg[0], c._reg[0]),
+                        _mm512_fmadd_pd(_reg[1], b._reg[1], c._reg[1])
+                    };
+    #elif defined(SYMD_SSE) && defined(SYMD_FMA)
+                    return typename UnderlyingRegister<T>::Type{
+                        _mm256_fmadd_pd(_reg[0], b._reg[0], c._reg[0]),
+                        _mm256_fmadd_pd(_reg[1], b._reg[1], c._reg[1])
+                    };
+    #elif defined SYMD_NEON
+                    return typename UnderlyingRegister<T>::Type{
+                        vfmaq_f64(c._reg[0], _reg[0], b._reg[0]),
+                        vfmaq_f64(c._reg[1], _reg[1], b._reg[1])
+                    };
+    #else
+                    return *this * b + c;
+    #endif
+                }
+                else
+                {
+                    // Integer multiply-add is exact anyway
+                    return *this * b + c;
+                }
+            }
+
+            // Adds with saturation: results are clamped to range of T instead of wrapping around.
+            SymdRegister adds(const SymdRegister<T>& other) const
+            {
+                static_assert(std::is_same_v<T, unsigned char> || is_16bit_int<T>,
+                    "Saturating addition is supported for unsigned char and 16 bit integers.");
+
+                if constexpr (std::is_same_v<T, unsigned char>)
+                {
+    #ifdef SYMD_SSE
+                    return _mm_adds_epu8(_reg, other._reg);
+    #elif defined SYMD_NEON
+                    return vqadd_u8(_reg, other._reg);
+    #endif
+                }
+                else if constexpr (std::is_same_v<T, int16_t>)
+                {
+    #ifdef SYMD_AVX512
+                    return _mm256_adds_epi16(_reg, other._reg);
+    #elif defined SYMD_SSE
+                    return _mm_adds_epi16(_reg, other._reg);
+    #elif defined SYMD_NEON
+                    return vqadd_s16(_reg, other._reg);
+    #endif
+                }
+                else if constexpr (std::is_same_v<T, uint16_t>)
+                {
+    #ifdef SYMD_AVX512
+                    return _mm256_adds_epu16(_reg, other._reg);
+    #elif defined SYMD_SSE
+                    return _mm_adds_epu16(_reg, other._reg);
+    #elif defined SYMD_NEON
+                    return vqadd_u16(_reg, other._reg);
+    #endif
+                }
+            }
+
+            // Subtracts with saturation: results are clamped to range of T instead of wrapping around.
+            SymdRegister subs(const SymdRegister<T>& other) const
+            {
+                static_assert(std::is_same_v<T, unsigned char> || is_16bit_int<T>,
+                    "Saturating subtraction is supported for unsigned char and 16 bit integers.");
+
+                if constexpr (std::is_same_v<T, unsigned char>)
+                {
+    #ifdef SYMD_SSE
+                    return _mm_subs_epu8(_reg, other._reg);
+    #elif defined SYMD_NEON
+                    return vqsub_u8(_reg, other._reg);
+    #endif
+                }
+                else if constexpr (std::is_same_v<T, int16_t>)
+                {
+    #ifdef SYMD_AVX512
+                    return _mm256_subs_epi16(_reg, other._reg);
+    #elif defined SYMD_SSE
+                    return _mm_subs_epi16(_reg, other._reg);
+    #elif defined SYMD_NEON
+                    return vqsub_s16(_reg, other._reg);
+    #endif
+                }
+                else if constexpr (std::is_same_v<T, uint16_t>)
+                {
+    #ifdef SYMD_AVX512
+                    return _mm256_subs_epu16(_reg, other._reg);
+    #elif defined SYMD_SSE
+                    return _mm_subs_epu16(_reg, other._reg);
+    #elif defined SYMD_NEON
+                    return vqsub_u16(_reg, other._reg);
+    #endif
+                }
+            }
+
+            // Rounding average (a + b + 1) >> 1, computed without overflow.
+            SymdRegister avg(const SymdRegister<T>& other) const
+            {
+                static_assert(std::is_same_v<T, unsigned char> || is_16bit_int<T>,
+                    "Rounding average is supported for unsigned char and 16 bit integers.");
+
+                if constexpr (std::is_same_v<T, unsigned char>)
+                {
+    #ifdef SYMD_SSE
+                    return _mm_avg_epu8(_reg, other._reg);
+    #elif defined SYMD_NEON
+                    return vrhadd_u8(_reg, other._reg);
+    #endif
+                }
+                else if constexpr (std::is_same_v<T, int16_t>)
+                {
+    #ifdef SYMD_AVX512
+                    // No signed average instruction - flipping sign bit maps int16_t to uint16_t preserving order
+                    const __m256i signBit = _mm256_set1_epi16((short)0x8000);
+                    return _mm256_xor_si256(_mm256_avg_epu16(_mm256_xor_si256(_reg, signBit), _mm256_xor_si256(other._reg, signBit)), signBit);
+    #elif defined SYMD_SSE
+                    const __m128i signBit = _mm_set1_epi16((short)0x8000);
+                    return _mm_xor_si128(_mm_avg_epu16(_mm_xor_si128(_reg, signBit), _mm_xor_si128(other._reg, signBit)), signBit);
+    #elif defined SYMD_NEON
+                    return vrhadd_s16(_reg, other._reg);
+    #endif
+                }
+                else if constexpr (std::is_same_v<T, uint16_t>)
+                {
+    #ifdef SYMD_AVX512
+                    return _mm256_avg_epu16(_reg, other._reg);
+    #elif defined SYMD_SSE
+                    return _mm_avg_epu16(_reg, other._reg);
+    #elif defined SYMD_NEON
+                    return vrhadd_u16(_reg, other._reg);
+    #endif
+                }
+            }
+
             SymdRegister operator/(const SymdRegister<T>& other) const
             {
                 static_assert(!std::is_same_v<T, int>, "Division not supported for int. Convert to other type.");
                 static_assert(!std::is_same_v<T, unsigned char>, "Division not supported for unsigned char. Convert to other type.");
+                static_assert(!is_16bit_int<T>, "Division not supported for 16 bit integers. Convert to other type.");
 
                 if constexpr (std::is_same_v<T, float> || std::is_same_v<T, symd::bfloat16>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _mm512_div_ps(_reg, other._reg);
+    #elif defined SYMD_SSE
                     return _mm256_div_ps(_reg, other._reg);
     #elif defined SYMD_NEON
                     return vdivq_f32(_reg, other._reg);
@@ -451,7 +1311,10 @@ namespace symd
                 else if constexpr (std::is_same_v<T, double>)
                 {
                     return typename UnderlyingRegister<T>::Type{
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                        _mm512_div_pd(_reg[0], other._reg[0]),
+                        _mm512_div_pd(_reg[1], other._reg[1])
+    #elif defined SYMD_SSE
                         _mm256_div_pd(_reg[0], other._reg[0]),
                         _mm256_div_pd(_reg[1], other._reg[1])
     #elif defined SYMD_NEON
@@ -466,7 +1329,9 @@ namespace symd
             {
                 if constexpr (std::is_same_v<T, float> || std::is_same_v<T, symd::bfloat16>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _mm512_and_ps(_reg, other._reg);
+    #elif defined SYMD_SSE
                     return _mm256_and_ps(_reg, other._reg);
     #elif defined SYMD_NEON
                     return vreinterpretq_f32_u32(vandq_u32((uint32x4_t)_reg, (uint32x4_t)other._reg));
@@ -474,7 +1339,9 @@ namespace symd
                 }
                 else if constexpr (std::is_same_v<T, int>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _mm512_and_si512(_reg, other._reg);
+    #elif defined SYMD_SSE
                     return _mm256_and_si256(_reg, other._reg);
     #elif defined SYMD_NEON
                     return vandq_s32(_reg, other._reg),
@@ -486,12 +1353,28 @@ namespace symd
                     return _mm_and_si128(_reg, other._reg);
     #elif defined SYMD_NEON
                     return vand_u8(_reg, other._reg);
+    #endif
+                }
+                else if constexpr (is_16bit_int<T>)
+                {
+    #ifdef SYMD_AVX512
+                    return _mm256_and_si256(_reg, other._reg);
+    #elif defined SYMD_SSE
+                    return _mm_and_si128(_reg, other._reg);
+    #elif defined SYMD_NEON
+                    if constexpr (std::is_same_v<T, int16_t>)
+                        return vand_s16(_reg, other._reg);
+                    else
+                        return vand_u16(_reg, other._reg);
     #endif
                 }
                 else if constexpr (std::is_same_v<T, double>)
                 {
                     return typename UnderlyingRegister<T>::Type{
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                        _mm512_and_pd(_reg[0], other._reg[0]),
+                        _mm512_and_pd(_reg[1], other._reg[1])
+    #elif defined SYMD_SSE
                         _mm256_and_pd(_reg[0], other._reg[0]),
                         _mm256_and_pd(_reg[1], other._reg[1])
     #elif defined SYMD_NEON
@@ -506,7 +1389,9 @@ namespace symd
             {
                 if constexpr (std::is_same_v<T, float> || std::is_same_v<T, symd::bfloat16>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _mm512_or_ps(_reg, other._reg);
+    #elif defined SYMD_SSE
                     return _mm256_or_ps(_reg, other._reg);
     #elif defined SYMD_NEON
                     return vreinterpretq_f32_u32(vorrq_u32((uint32x4_t)_reg, (uint32x4_t)other._reg));
@@ -514,7 +1399,9 @@ namespace symd
                 }
                 else if constexpr (std::is_same_v<T, int>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _mm512_or_si512(_reg, other._reg);
+    #elif defined SYMD_SSE
                     return _mm256_or_si256(_reg, other._reg);
     #elif defined SYMD_NEON
                     return vorrq_s32(_reg, other._reg);
@@ -526,12 +1413,28 @@ namespace symd
                     return _mm_or_si128(_reg, other._reg);
     #elif defined SYMD_NEON
                     return vorr_u8(_reg, other._reg);
+    #endif
+                }
+                else if constexpr (is_16bit_int<T>)
+                {
+    #ifdef SYMD_AVX512
+                    return _mm256_or_si256(_reg, other._reg);
+    #elif defined SYMD_SSE
+                    return _mm_or_si128(_reg, other._reg);
+    #elif defined SYMD_NEON
+                    if constexpr (std::is_same_v<T, int16_t>)
+                        return vorr_s16(_reg, other._reg);
+                    else
+                        return vorr_u16(_reg, other._reg);
     #endif
                 }
                 else if constexpr (std::is_same_v<T, double>)
                 {
                     return typename UnderlyingRegister<T>::Type{
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                        _mm512_or_pd(_reg[0], other._reg[0]),
+                        _mm512_or_pd(_reg[1], other._reg[1])
+    #elif defined SYMD_SSE
                         _mm256_or_pd(_reg[0], other._reg[0]),
                         _mm256_or_pd(_reg[1], other._reg[1])
     #elif defined SYMD_NEON
@@ -546,7 +1449,9 @@ namespace symd
             {
                 if constexpr (std::is_same_v<T, float> || std::is_same_v<T, symd::bfloat16>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _mm512_xor_ps(_reg, other._reg);
+    #elif defined SYMD_SSE
                     return _mm256_xor_ps(_reg, other._reg);
     #elif defined SYMD_NEON
                     return vreinterpretq_f32_u32(vxorq_u32((uint32x4_t)_reg, (uint32x4_t)other._reg));
@@ -554,7 +1459,9 @@ namespace symd
                 }
                 else if constexpr (std::is_same_v<T, int>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _mm512_xor_si512(_reg, other._reg);
+    #elif defined SYMD_SSE
                     return _mm256_xor_si256(_reg, other._reg);
     #elif defined SYMD_NEON
                     return veorq_s32(_reg, other._reg);
@@ -566,12 +1473,28 @@ namespace symd
                     return _mm_xor_si128(_reg, other._reg);
     #elif defined SYMD_NEON
                     return veor_u8(_reg, other._reg);
+    #endif
+                }
+                else if constexpr (is_16bit_int<T>)
+                {
+    #ifdef SYMD_AVX512
+                    return _mm256_xor_si256(_reg, other._reg);
+    #elif defined SYMD_SSE
+                    return _mm_xor_si128(_reg, other._reg);
+    #elif defined SYMD_NEON
+                    if constexpr (std::is_same_v<T, int16_t>)
+                        return veor_s16(_reg, other._reg);
+                    else
+                        return veor_u16(_reg, other._reg);
     #endif
                 }
                 else if constexpr (std::is_same_v<T, double>)
                 {
                     return typename UnderlyingRegister<T>::Type{
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                        _mm512_xor_pd(_reg[0], other._reg[0]),
+                        _mm512_xor_pd(_reg[1], other._reg[1])
+    #elif defined SYMD_SSE
                         _mm256_xor_pd(_reg[0], other._reg[0]),
                         _mm256_xor_pd(_reg[1], other._reg[1])
     #elif defined SYMD_NEON
@@ -586,7 +1509,9 @@ namespace symd
             {
                 if constexpr (std::is_same_v<T, float> || std::is_same_v<T, symd::bfloat16>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _mm512_xor_ps(_reg, _mm512_castsi512_ps(_mm512_set1_epi32(-1)));
+    #elif defined SYMD_SSE
                     auto mask = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
                     return _mm256_andnot_ps(_reg, mask);
     #elif defined SYMD_NEON
@@ -595,7 +1520,9 @@ namespace symd
                 }
                 else if constexpr (std::is_same_v<T, int>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _mm512_xor_si512(_reg, _mm512_set1_epi32(-1));
+    #elif defined SYMD_SSE
                     return _mm256_andnot_si256(_reg, _mm256_set1_epi32(-1));
     #elif defined SYMD_NEON
                     return vmvnq_s32(_reg);
@@ -607,11 +1534,30 @@ namespace symd
                     return _mm_andnot_si128(_reg, _mm_set1_epi32(-1));
     #elif defined SYMD_NEON
                     return vmvn_u8(_data);
+    #endif
+                }
+                else if constexpr (is_16bit_int<T>)
+                {
+    #ifdef SYMD_AVX512
+                    return _mm256_xor_si256(_reg, _mm256_set1_epi32(-1));
+    #elif defined SYMD_SSE
+                    return _mm_andnot_si128(_reg, _mm_set1_epi32(-1));
+    #elif defined SYMD_NEON
+                    if constexpr (std::is_same_v<T, int16_t>)
+                        return vmvn_s16(_reg);
+                    else
+                        return vmvn_u16(_reg);
     #endif
                 }
                 else if constexpr (std::is_same_v<T, double>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    __m512d mask = _mm512_castsi512_pd(_mm512_set1_epi32(-1));
+
+                    return typename UnderlyingRegister<T>::Type{
+                        _mm512_xor_pd(_reg[0], mask),
+                        _mm512_xor_pd(_reg[1], mask)
+    #elif defined SYMD_SSE
                     __m256d mask = _mm256_castsi256_pd(_mm256_set1_epi32(-1));
 
                     return typename UnderlyingRegister<T>::Type{
@@ -627,16 +1573,39 @@ namespace symd
             }
 
             // Shift packed 32-bit integers in a right by count while shifting in zeros, and store the results in dst.
+            // 16 bit integers shift like scalars: int16_t shifts in sign bits, uint16_t zeros.
             SymdRegister operator>>(int num_bits) const
             {
-                static_assert(std::is_same_v<T, int>,
-                   "Shift opperations only supported in int registers -> convert to int");
+                static_assert(std::is_same_v<T, int> || is_16bit_int<T>,
+                   "Shift opperations only supported in int and 16 bit integer registers -> convert to int");
 
                 if constexpr (std::is_same_v<T, int>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _mm512_srli_epi32(_reg, num_bits);
+    #elif defined SYMD_SSE
                     return _mm256_srli_epi32(_reg, num_bits);
     #elif defined SYMD_NEON
+    #endif
+                }
+                else if constexpr (std::is_same_v<T, int16_t>)
+                {
+    #ifdef SYMD_AVX512
+                    return _mm256_srai_epi16(_reg, num_bits);
+    #elif defined SYMD_SSE
+                    return _mm_srai_epi16(_reg, num_bits);
+    #elif defined SYMD_NEON
+                    return vshl_s16(_reg, vdup_n_s16((short)-num_bits));
+    #endif
+                }
+                else if constexpr (std::is_same_v<T, uint16_t>)
+                {
+    #ifdef SYMD_AVX512
+                    return _mm256_srli_epi16(_reg, num_bits);
+    #elif defined SYMD_SSE
+                    return _mm_srli_epi16(_reg, num_bits);
+    #elif defined SYMD_NEON
+                    return vshl_u16(_reg, vdup_n_s16((short)-num_bits));
     #endif
                 }
             }
@@ -644,19 +1613,58 @@ namespace symd
             // Shift packed 32-bit integers in a left by imm8 while shifting in zeros, and store the results in dst.
             SymdRegister operator<<(int num_bits) const
             {
-                static_assert(std::is_same_v<T, int>,
-                   "Shift opperations only supported in int registers -> convert to int");
+                static_assert(std::is_same_v<T, int> || is_16bit_int<T>,
+                   "Shift opperations only supported in int and 16 bit integer registers -> convert to int");
 
                 if constexpr (std::is_same_v<T, int>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _mm512_slli_epi32(_reg, num_bits);
+    #elif defined SYMD_SSE
                     return _mm256_slli_epi32(_reg, num_bits);
     #elif defined SYMD_NEON
+    #endif
+                }
+                else if constexpr (is_16bit_int<T>)
+                {
+    #ifdef SYMD_AVX512
+                    return _mm256_slli_epi16(_reg, num_bits);
+    #elif defined SYMD_SSE
+                    return _mm_slli_epi16(_reg, num_bits);
+    #elif defined SYMD_NEON
+                    if constexpr (std::is_same_v<T, int16_t>)
+                        return vshl_s16(_reg, vdup_n_s16((short)num_bits));
+                    else
+                        return vshl_u16(_reg, vdup_n_s16((short)num_bits));
     #endif
                 }
             }
 
 
+    #ifdef SYMD_SSE
+            // Signed compare of 16 bit lanes. Unsigned values are shifted to signed range by flipping the sign bit.
+            static typename UnderlyingRegister<T>::Type _greater_16bit(typename UnderlyingRegister<T>::Type a, typename UnderlyingRegister<T>::Type b)
+            {
+        #ifdef SYMD_AVX512
+                if constexpr (std::is_same_v<T, uint16_t>)
+                {
+                    a = _mm256_xor_si256(a, _mm256_set1_epi16((short)0x8000));
+                    b = _mm256_xor_si256(b, _mm256_set1_epi16((short)0x8000));
+                }
+
+                return _mm256_cmpgt_epi16(a, b);
+        #else
+                if constexpr (std::is_same_v<T, uint16_t>)
+                {
+                    a = _mm_xor_si128(a, _mm_set1_epi16((short)0x8000));
+                    b = _mm_xor_si128(b, _mm_set1_epi16((short)0x8000));
+                }
+
+                return _mm_cmpgt_epi16(a, b);
+        #endif
+            }
+    #endif
+
             /////////////////////////////////////////////////////////////////////////////////////
             // Logical operators
             /////////////////////////////////////////////////////////////////////////////////////
@@ -675,7 +1683,9 @@ namespace symd
             {
                 if constexpr (std::is_same_v<T, float> || std::is_same_v<T, symd::bfloat16>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _from_kmask(_mm512_cmp_ps_mask(_reg, other._reg, _CMP_EQ_OQ));
+    #elif defined SYMD_SSE
                     return _mm256_cmp_ps(_reg, other._reg, _CMP_EQ_OQ);
     #elif defined SYMD_NEON
                     return vreinterpretq_f32_u32(vceqq_f32(_reg, other._reg));
@@ -683,7 +1693,9 @@ namespace symd
                 }
                 else if constexpr (std::is_same_v<T, int>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _from_kmask(_mm512_cmpeq_epi32_mask(_reg, other._reg));
+    #elif defined SYMD_SSE
                     return _mm256_cmpeq_epi32(_reg, other._reg);
     #elif defined SYMD_NEON
                     return vreinterpretq_s32_u32(vceqq_s32(_reg, other._reg));
@@ -695,12 +1707,28 @@ namespace symd
                     return _mm_cmpeq_epi8(_reg, other._reg);
     #elif defined SYMD_NEON
                     return vceq_u8(_reg, other._reg);
+    #endif
+                }
+                else if constexpr (is_16bit_int<T>)
+                {
+    #ifdef SYMD_AVX512
+                    return _mm256_cmpeq_epi16(_reg, other._reg);
+    #elif defined SYMD_SSE
+                    return _mm_cmpeq_epi16(_reg, other._reg);
+    #elif defined SYMD_NEON
+                    if constexpr (std::is_same_v<T, int16_t>)
+                        return vreinterpret_s16_u16(vceq_s16(_reg, other._reg));
+                    else
+                        return vceq_u16(_reg, other._reg);
     #endif
                 }
                 else if constexpr (std::is_same_v<T, double>)
                 {
                     return typename UnderlyingRegister<T>::Type{
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                       _mm512_castsi512_pd(_mm512_movm_epi64(_mm512_cmp_pd_mask(_reg[0], other._reg[0], _CMP_EQ_OQ))),
+                       _mm512_castsi512_pd(_mm512_movm_epi64(_mm512_cmp_pd_mask(_reg[1], other._reg[1], _CMP_EQ_OQ)))
+    #elif defined SYMD_SSE
                        _mm256_cmp_pd(_reg[0], other._reg[0], _CMP_EQ_OQ),
                        _mm256_cmp_pd(_reg[1], other._reg[1], _CMP_EQ_OQ)
     #elif defined SYMD_NEON
@@ -717,18 +1745,48 @@ namespace symd
                 return !(*this == other);
     #endif
 
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                if constexpr (std::is_same_v<T, float> || std::is_same_v<T, symd::bfloat16>)
+                {
+                    return _from_kmask(_mm512_cmp_ps_mask(_reg, other._reg, _CMP_NEQ_OQ));
+                }
+                else if constexpr (std::is_same_v<T, double>)
+                {
+                    return typename UnderlyingRegister<T>::Type {
+                       _mm512_castsi512_pd(_mm512_movm_epi64(_mm512_cmp_pd_mask(_reg[0], other._reg[0], _CMP_NEQ_OQ))),
+                       _mm512_castsi512_pd(_mm512_movm_epi64(_mm512_cmp_pd_mask(_reg[1], other._reg[1], _CMP_NEQ_OQ)))
+                    };
+                }
+                else if constexpr (std::is_same_v<T, int>)
+                {
+                    return _from_kmask(_mm512_cmpneq_epi32_mask(_reg, other._reg));
+                }
+                else if constexpr (is_16bit_int<T>)
+                {
+                    return _mm256_or_si256(_mm256_cmpgt_epi16(_reg, other._reg), _mm256_cmpgt_epi16(other._reg, _reg));
+                }
+                else
+                {
+                    return _mm_or_si128(_mm_cmpgt_epi8(_reg, other._reg), _mm_cmpgt_epi8(other._reg, _reg));
+                }
+    #elif defined SYMD_SSE
                 if constexpr (std::is_same_v<T, float> || std::is_same_v<T, symd::bfloat16>)
                 {
                     return _mm256_cmp_ps(_reg, other._reg, _CMP_NEQ_OQ);
                 }
+                // Integers differ when either is greater (signed order is fine for unsigned types too). Negated
+                // equality mask is miscompiled when it feeds blendv (GCC 12 at -O1 and above).
                 else if constexpr (std::is_same_v<T, int>)
                 {
-                    return !(*this == other);
+                    return _mm256_or_si256(_mm256_cmpgt_epi32(_reg, other._reg), _mm256_cmpgt_epi32(other._reg, _reg));
                 }
                 else if constexpr (std::is_same_v<T, unsigned char>)
                 {
-                    return !(*this == other);
+                    return _mm_or_si128(_mm_cmpgt_epi8(_reg, other._reg), _mm_cmpgt_epi8(other._reg, _reg));
+                }
+                else if constexpr (is_16bit_int<T>)
+                {
+                    return _mm_or_si128(_mm_cmpgt_epi16(_reg, other._reg), _mm_cmpgt_epi16(other._reg, _reg));
                 }
                 else if constexpr (std::is_same_v<T, double>)
                 {
@@ -746,7 +1804,9 @@ namespace symd
 
                 if constexpr (std::is_same_v<T, float> || std::is_same_v<T, symd::bfloat16>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _from_kmask(_mm512_cmp_ps_mask(_reg, other._reg, _CMP_LT_OQ));
+    #elif defined SYMD_SSE
                     return _mm256_cmp_ps(_reg, other._reg, _CMP_LT_OQ);
     #elif defined SYMD_NEON
                     return vreinterpretq_f32_u32(vcltq_f32(_reg, other._reg));
@@ -754,16 +1814,25 @@ namespace symd
                 }
                 else if constexpr (std::is_same_v<T, int>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _from_kmask(_mm512_cmplt_epi32_mask(_reg, other._reg));
+    #elif defined SYMD_SSE
                     return _mm256_cmpgt_epi32(other._reg, _reg);
     #elif defined SYMD_NEON
                     return vreinterpretq_s32_u32(vcltq_s32(_reg, other._reg));
     #endif
                 }
+                else if constexpr (is_16bit_int<T>)
+                {
+                    return other > *this;
+                }
                 else if constexpr (std::is_same_v<T, double>)
                 {
                     return typename UnderlyingRegister<T>::Type{
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                       _mm512_castsi512_pd(_mm512_movm_epi64(_mm512_cmp_pd_mask(_reg[0], other._reg[0], _CMP_LT_OQ))),
+                       _mm512_castsi512_pd(_mm512_movm_epi64(_mm512_cmp_pd_mask(_reg[1], other._reg[1], _CMP_LT_OQ)))
+    #elif defined SYMD_SSE
                        _mm256_cmp_pd(_reg[0], other._reg[0], _CMP_LT_OQ),
                        _mm256_cmp_pd(_reg[1], other._reg[1], _CMP_LT_OQ)
     #elif defined SYMD_NEON
@@ -780,7 +1849,9 @@ namespace symd
 
                 if constexpr (std::is_same_v<T, float> || std::is_same_v<T, symd::bfloat16>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _from_kmask(_mm512_cmp_ps_mask(_reg, other._reg, _CMP_GT_OQ));
+    #elif defined SYMD_SSE
                     return _mm256_cmp_ps(_reg, other._reg, _CMP_GT_OQ);
     #elif defined SYMD_NEON
                     return vreinterpretq_f32_u32(vcgtq_f32(_reg, other._reg));
@@ -788,16 +1859,32 @@ namespace symd
                 }
                 else if constexpr (std::is_same_v<T, int>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _from_kmask(_mm512_cmpgt_epi32_mask(_reg, other._reg));
+    #elif defined SYMD_SSE
                     return _mm256_cmpgt_epi32(_reg, other._reg);
     #elif defined SYMD_NEON
                     return vreinterpretq_s32_u32(vcgtq_s32(_reg, other._reg));
+    #endif
+                }
+                else if constexpr (is_16bit_int<T>)
+                {
+    #ifdef SYMD_SSE
+                    return _greater_16bit(_reg, other._reg);
+    #elif defined SYMD_NEON
+                    if constexpr (std::is_same_v<T, int16_t>)
+                        return vreinterpret_s16_u16(vcgt_s16(_reg, other._reg));
+                    else
+                        return vcgt_u16(_reg, other._reg);
     #endif
                 }
                 else if constexpr (std::is_same_v<T, double>)
                 {
                     return typename UnderlyingRegister<T>::Type{
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                       _mm512_castsi512_pd(_mm512_movm_epi64(_mm512_cmp_pd_mask(_reg[0], other._reg[0], _CMP_GT_OQ))),
+                       _mm512_castsi512_pd(_mm512_movm_epi64(_mm512_cmp_pd_mask(_reg[1], other._reg[1], _CMP_GT_OQ)))
+    #elif defined SYMD_SSE
                        _mm256_cmp_pd(_reg[0], other._reg[0], _CMP_GT_OQ),
                        _mm256_cmp_pd(_reg[1], other._reg[1], _CMP_GT_OQ)
     #elif defined SYMD_NEON
@@ -814,20 +1901,25 @@ namespace symd
 
                 if constexpr (std::is_same_v<T, float> || std::is_same_v<T, symd::bfloat16>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _from_kmask(_mm512_cmp_ps_mask(_reg, other._reg, _CMP_LE_OQ));
+    #elif defined SYMD_SSE
                     return _mm256_cmp_ps(_reg, other._reg, _CMP_LE_OQ);
     #elif defined SYMD_NEON
                     return vreinterpretq_f32_u32(vcleq_f32(_reg, other._reg));
     #endif
                 }
-                else if constexpr (std::is_same_v<T, int>)
+                else if constexpr (std::is_same_v<T, int> || is_16bit_int<T>)
                 {
                     return !(*this > other);
                 }
                 else if constexpr (std::is_same_v<T, double>)
                 {
                     return typename UnderlyingRegister<T>::Type{
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                       _mm512_castsi512_pd(_mm512_movm_epi64(_mm512_cmp_pd_mask(_reg[0], other._reg[0], _CMP_LE_OQ))),
+                       _mm512_castsi512_pd(_mm512_movm_epi64(_mm512_cmp_pd_mask(_reg[1], other._reg[1], _CMP_LE_OQ)))
+    #elif defined SYMD_SSE
                        _mm256_cmp_pd(_reg[0], other._reg[0], _CMP_LE_OQ),
                        _mm256_cmp_pd(_reg[1], other._reg[1], _CMP_LE_OQ)
     #elif defined SYMD_NEON
@@ -844,20 +1936,25 @@ namespace symd
 
                 if constexpr (std::is_same_v<T, float> || std::is_same_v<T, symd::bfloat16>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _from_kmask(_mm512_cmp_ps_mask(_reg, other._reg, _CMP_GE_OQ));
+    #elif defined SYMD_SSE
                     return _mm256_cmp_ps(_reg, other._reg, _CMP_GE_OQ);
     #elif defined SYMD_NEON
                     return vreinterpretq_f32_u32(vcgeq_f32(_reg, other._reg));
     #endif
                 }
-                else if constexpr (std::is_same_v<T, int>)
+                else if constexpr (std::is_same_v<T, int> || is_16bit_int<T>)
                 {
                     return !(*this < other);
                 }
                 else if constexpr (std::is_same_v<T, double>)
                 {
                     return typename UnderlyingRegister<T>::Type{
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                       _mm512_castsi512_pd(_mm512_movm_epi64(_mm512_cmp_pd_mask(_reg[0], other._reg[0], _CMP_GE_OQ))),
+                       _mm512_castsi512_pd(_mm512_movm_epi64(_mm512_cmp_pd_mask(_reg[1], other._reg[1], _CMP_GE_OQ)))
+    #elif defined SYMD_SSE
                        _mm256_cmp_pd(_reg[0], other._reg[0], _CMP_GE_OQ),
                        _mm256_cmp_pd(_reg[1], other._reg[1], _CMP_GE_OQ)
     #elif defined SYMD_NEON
@@ -877,7 +1974,9 @@ namespace symd
             {
                 if constexpr (std::is_same_v<T, float> || std::is_same_v<T, symd::bfloat16>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _mm512_min_ps(_reg, other._reg);
+    #elif defined SYMD_SSE
                     return _mm256_min_ps(_reg, other._reg);
     #elif defined SYMD_NEON
                     return vminq_f32(_reg, other._reg);
@@ -885,7 +1984,9 @@ namespace symd
                 }
                 else if constexpr (std::is_same_v<T, int>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _mm512_min_epi32(_reg, other._reg);
+    #elif defined SYMD_SSE
                     return _mm256_min_epi32(_reg, other._reg);
     #elif defined SYMD_NEON
                     return vminq_s32(_reg, other._reg);
@@ -897,12 +1998,29 @@ namespace symd
                     return _mm_min_epu8(_reg, other._reg);
     #elif defined SYMD_NEON
                     return vmin_u8(_reg, other._reg);
+    #endif
+                }
+                else if constexpr (is_16bit_int<T>)
+                {
+                    constexpr bool isSigned = std::is_same_v<T, int16_t>;
+    #ifdef SYMD_AVX512
+                    return isSigned ? _mm256_min_epi16(_reg, other._reg) : _mm256_min_epu16(_reg, other._reg);
+    #elif defined SYMD_SSE
+                    return isSigned ? _mm_min_epi16(_reg, other._reg) : _mm_min_epu16(_reg, other._reg);
+    #elif defined SYMD_NEON
+                    if constexpr (std::is_same_v<T, int16_t>)
+                        return vmin_s16(_reg, other._reg);
+                    else
+                        return vmin_u16(_reg, other._reg);
     #endif
                 }
                 else if constexpr (std::is_same_v<T, double>)
                 {
                     return typename UnderlyingRegister<T>::Type{
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                       _mm512_min_pd(_reg[0], other._reg[0]),
+                       _mm512_min_pd(_reg[1], other._reg[1])
+    #elif defined SYMD_SSE
                        _mm256_min_pd(_reg[0], other._reg[0]),
                        _mm256_min_pd(_reg[1], other._reg[1])
     #elif defined SYMD_NEON
@@ -917,7 +2035,9 @@ namespace symd
             {
                 if constexpr (std::is_same_v<T, float> || std::is_same_v<T, symd::bfloat16>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _mm512_max_ps(_reg, other._reg);
+    #elif defined SYMD_SSE
                     return _mm256_max_ps(_reg, other._reg);
     #elif defined SYMD_NEON
                     return vmaxq_f32(_reg, other._reg);
@@ -925,7 +2045,9 @@ namespace symd
                 }
                 else if constexpr (std::is_same_v<T, int>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _mm512_max_epi32(_reg, other._reg);
+    #elif defined SYMD_SSE
                     return _mm256_max_epi32(_reg, other._reg);
     #elif defined SYMD_NEON
                     return vmaxq_s32(_reg, other._reg);
@@ -937,12 +2059,29 @@ namespace symd
                     return _mm_max_epu8(_reg, other._reg);
     #elif defined SYMD_NEON
                     return vmax_u8(_reg, other._reg);
+    #endif
+                }
+                else if constexpr (is_16bit_int<T>)
+                {
+                    constexpr bool isSigned = std::is_same_v<T, int16_t>;
+    #ifdef SYMD_AVX512
+                    return isSigned ? _mm256_max_epi16(_reg, other._reg) : _mm256_max_epu16(_reg, other._reg);
+    #elif defined SYMD_SSE
+                    return isSigned ? _mm_max_epi16(_reg, other._reg) : _mm_max_epu16(_reg, other._reg);
+    #elif defined SYMD_NEON
+                    if constexpr (std::is_same_v<T, int16_t>)
+                        return vmax_s16(_reg, other._reg);
+                    else
+                        return vmax_u16(_reg, other._reg);
     #endif
                 }
                 else if constexpr (std::is_same_v<T, double>)
                 {
                     return typename UnderlyingRegister<T>::Type{
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                       _mm512_max_pd(_reg[0], other._reg[0]),
+                       _mm512_max_pd(_reg[1], other._reg[1])
+    #elif defined SYMD_SSE
                        _mm256_max_pd(_reg[0], other._reg[0]),
                        _mm256_max_pd(_reg[1], other._reg[1])
     #elif defined SYMD_NEON
@@ -961,7 +2100,14 @@ namespace symd
 
                 if constexpr (std::is_same_v<T, float> || std::is_same_v<T, symd::bfloat16>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    __m512i integer_repr = _mm512_castps_si512(_reg);
+                    integer_repr = _mm512_slli_epi32(integer_repr, 1);
+                    integer_repr = _mm512_srli_epi32(integer_repr, 24);
+                    integer_repr = _mm512_sub_epi32(integer_repr, _mm512_set1_epi32(127));
+                    return integer_repr;
+
+    #elif defined SYMD_SSE
                     __m256i integer_repr = _mm256_castps_si256(_reg); // Cast to integer so we can use bit ops
                     integer_repr = _mm256_slli_epi32(integer_repr, 1); // Shift left by one bit to align exp...
                     integer_repr = _mm256_srli_epi32(integer_repr, 24); // Shift right by 24 bits to align exp to right...
@@ -994,7 +2140,13 @@ namespace symd
 
                 if constexpr (std::is_same_v<T, float> || std::is_same_v<T, symd::bfloat16>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    __m512i integer_repr = _mm512_castps_si512(_reg);
+                    integer_repr = _mm512_srli_epi32(integer_repr, 23);
+                    integer_repr = _mm512_slli_epi32(integer_repr, 23);
+                    return _mm512_castsi512_ps(integer_repr);
+
+    #elif defined SYMD_SSE
                     // Interpret the memory location of the float as an unsigned integer to manipulate its bits directly.
                     __m256i integer_repr = _mm256_castps_si256(_reg);
 
@@ -1033,13 +2185,26 @@ namespace symd
                 if constexpr (std::is_same_v<T, float> || std::is_same_v<T, symd::bfloat16>)
                 {
                     SymdRegister<int> integer_exp = (n + 127) << 23;
+    #ifdef SYMD_AVX512
+                    return _mm512_castsi512_ps(integer_exp._reg);
+    #else
                     return _mm256_castsi256_ps(integer_exp._reg);
+    #endif
                 }
                 else if constexpr (std::is_same_v<T, double>)
                 {
                     // https://en.wikipedia.org/wiki/Double-precision_floating-point_format
                     SymdRegister<int> integer_exp = n + 1023;
 
+    #ifdef SYMD_AVX512
+                    __m512i lo_64 = _mm512_cvtepi32_epi64(_mm512_castsi512_si256(integer_exp._reg));
+                    __m512i hi_64 = _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(integer_exp._reg, 1));
+
+                    return typename UnderlyingRegister<T>::Type{
+                        _mm512_castsi512_pd(_mm512_slli_epi64(lo_64, 52)),
+                        _mm512_castsi512_pd(_mm512_slli_epi64(hi_64, 52))
+                    };
+    #else
                     __m256i lo_64 = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(integer_exp._reg, 0));
                     __m256i hi_64 = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(integer_exp._reg, 1));
 
@@ -1050,6 +2215,7 @@ namespace symd
                         _mm256_castsi256_pd(lo_64),
                         _mm256_castsi256_pd(hi_64)
                     };
+    #endif
                 }
             }
 
@@ -1058,7 +2224,9 @@ namespace symd
             {
                 if constexpr (std::is_same_v<T, float> || std::is_same_v<T, symd::bfloat16>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _mm512_mask_blend_ps(_kmask(), sec._reg, first._reg);
+    #elif defined SYMD_SSE
                     return _mm256_blendv_ps(sec._reg, first._reg, _reg);
     #elif defined SYMD_NEON
                     return vbslq_f32(vreinterpretq_u32_f32(_reg), first._reg, sec._reg),
@@ -1066,7 +2234,9 @@ namespace symd
                 }
                 else if constexpr (std::is_same_v<T, int>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _mm512_mask_blend_epi32(_kmask(), sec._reg, first._reg);
+    #elif defined SYMD_SSE
                     return _mm256_blendv_epi8(sec._reg, first._reg, _reg);
     #elif defined SYMD_NEON
                     return vbslq_s32(vreinterpretq_u32_s32(_reg[0]), first._reg[0], sec._reg[0]);
@@ -1079,12 +2249,28 @@ namespace symd
                     return _mm_blendv_epi8(sec._reg, first._reg, _reg);
     #elif defined SYMD_NEON
                     return vbsl_u8(_reg, first._reg, sec._reg);
+    #endif
+                }
+                else if constexpr (is_16bit_int<T>)
+                {
+    #ifdef SYMD_AVX512
+                    return _mm256_blendv_epi8(sec._reg, first._reg, _reg);
+    #elif defined SYMD_SSE
+                    return _mm_blendv_epi8(sec._reg, first._reg, _reg);
+    #elif defined SYMD_NEON
+                    if constexpr (std::is_same_v<T, int16_t>)
+                        return vbsl_s16(vreinterpret_u16_s16(_reg), first._reg, sec._reg);
+                    else
+                        return vbsl_u16(_reg, first._reg, sec._reg);
     #endif
                 }
                 else if constexpr (std::is_same_v<T, double>)
                 {
                     return typename UnderlyingRegister<T>::Type{
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                       _mm512_mask_blend_pd((__mmask8)_kmask(), sec._reg[0], first._reg[0]),
+                       _mm512_mask_blend_pd((__mmask8)(_kmask() >> 8), sec._reg[1], first._reg[1])
+    #elif defined SYMD_SSE
                        _mm256_blendv_pd(sec._reg[0], first._reg[0], _reg[0]),
                        _mm256_blendv_pd(sec._reg[1], first._reg[1], _reg[1])
     #elif defined SYMD_NEON
@@ -1107,7 +2293,9 @@ namespace symd
                 }
                 else if constexpr (std::is_same_v<T, int>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _mm512_abs_epi32(_reg);
+    #elif defined SYMD_SSE
                     return _mm256_abs_epi32(_reg);
     #elif defined SYMD_NEON
                     return vabsq_s32(_reg);
@@ -1118,6 +2306,20 @@ namespace symd
                     // If x is usnigned than x == abs(x)
                     return *this;
                 }
+                else if constexpr (std::is_same_v<T, int16_t>)
+                {
+    #ifdef SYMD_AVX512
+                    return _mm256_abs_epi16(_reg);
+    #elif defined SYMD_SSE
+                    return _mm_abs_epi16(_reg);
+    #elif defined SYMD_NEON
+                    return vabs_s16(_reg);
+    #endif
+                }
+                else if constexpr (std::is_same_v<T, uint16_t>)
+                {
+                    return *this;
+                }
                 else if constexpr (std::is_same_v<T, double>)
                 {
     #ifdef SYMD_SSE
@@ -1135,7 +2337,9 @@ namespace symd
             {
                 if constexpr (std::is_same_v<T, float>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    _mm512_storeu_ps(dst, _reg);
+    #elif defined SYMD_SSE
                     _mm256_storeu_ps(dst, _reg);
     #elif defined SYMD_NEON
                     vst1q_f32(dst, _reg);
@@ -1143,7 +2347,12 @@ namespace symd
                 }
                 else if constexpr (std::is_same_v<T, symd::bfloat16>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    // Keep upper half of each float
+                    __m256i shorts = _mm512_cvtepi32_epi16(_mm512_srli_epi32(_mm512_castps_si512(_reg), 16));
+                    _mm256_storeu_si256((__m256i*)dst, shorts);
+
+    #elif defined SYMD_SSE
                     __m256i int_reg = _mm256_castps_si256(_reg);
                     __m256i shuffled_hi = _mm256_shufflehi_epi16(int_reg, 0b00001101);
                     __m256i shuffled_16 = _mm256_shufflelo_epi16(shuffled_hi, 0b00001101);
@@ -1159,7 +2368,9 @@ namespace symd
                 }
                 else if constexpr (std::is_same_v<T, int>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    _mm512_storeu_si512(dst, _reg);
+    #elif defined SYMD_SSE
                     _mm256_storeu_si256((__m256i*)dst, _reg);
     #elif defined SYMD_NEON
                     vst1q_s32(dst, _reg);
@@ -1167,15 +2378,33 @@ namespace symd
                 }
                 else if constexpr (std::is_same_v<T, unsigned char>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    _mm_storeu_si128((__m128i*)dst, _reg);
+    #elif defined SYMD_SSE
                     _mm_storeu_si64((__m128i*)dst, _reg);
     #elif defined SYMD_NEON
                     std::memcpy(dst, _ptrToData, SYMD_LEN * sizeof(T));
+    #endif
+                }
+                else if constexpr (is_16bit_int<T>)
+                {
+    #ifdef SYMD_AVX512
+                    _mm256_storeu_si256((__m256i*)dst, _reg);
+    #elif defined SYMD_SSE
+                    _mm_storeu_si128((__m128i*)dst, _reg);
+    #elif defined SYMD_NEON
+                    if constexpr (std::is_same_v<T, int16_t>)
+                        vst1_s16(dst, _reg);
+                    else
+                        vst1_u16(dst, _reg);
     #endif
                 }
                 else if constexpr (std::is_same_v<T, double>)
                 {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    _mm512_storeu_pd(dst + 0, _reg[0]);
+                    _mm512_storeu_pd(dst + 8, _reg[1]);
+    #elif defined SYMD_SSE
                     _mm256_storeu_pd(dst + 0, _reg[0]);
                     _mm256_storeu_pd(dst + 4, _reg[1]);
     #elif defined SYMD_NEON
@@ -1185,12 +2414,235 @@ namespace symd
                 }
             }
 
+            // Stores register to memory aligned to size of register, counterpart of load_aligned.
+            void store_aligned(T* dst) const
+            {
+                assert((uintptr_t)dst % symd_alignment<T> == 0);
+
+                if constexpr (std::is_same_v<T, float>)
+                {
+    #ifdef SYMD_AVX512
+                    _mm512_store_ps(dst, _reg);
+    #elif defined SYMD_SSE
+                    _mm256_store_ps(dst, _reg);
+    #elif defined SYMD_NEON
+                    vst1q_f32(dst, _reg);
+    #endif
+                }
+                else if constexpr (std::is_same_v<T, int>)
+                {
+    #ifdef SYMD_AVX512
+                    _mm512_store_si512(dst, _reg);
+    #elif defined SYMD_SSE
+                    _mm256_store_si256((__m256i*)dst, _reg);
+    #elif defined SYMD_NEON
+                    vst1q_s32(dst, _reg);
+    #endif
+                }
+                else if constexpr (std::is_same_v<T, double>)
+                {
+    #ifdef SYMD_AVX512
+                    _mm512_store_pd(dst + 0, _reg[0]);
+                    _mm512_store_pd(dst + 8, _reg[1]);
+    #elif defined SYMD_SSE
+                    _mm256_store_pd(dst + 0, _reg[0]);
+                    _mm256_store_pd(dst + 4, _reg[1]);
+    #elif defined SYMD_NEON
+                    vst1q_f64(dst + 0, _reg[0]);
+                    vst1q_f64(dst + 2, _reg[1]);
+    #endif
+                }
+                else
+                {
+                    store(dst);
+                }
+            }
+
+            // Non-temporal store which bypasses cache, for large outputs which are not read soon. dst must be aligned
+            // to symd_alignment<T>. Stores become visible to other threads after symd::__internal__::stream_fence.
+            void store_stream(T* dst) const
+            {
+                assert((uintptr_t)dst % symd_alignment<T> == 0);
+
+    #if defined SYMD_AVX512 || defined SYMD_SSE
+                if constexpr (std::is_same_v<T, float>)
+                {
+        #ifdef SYMD_AVX512
+                    _mm512_stream_ps(dst, _reg);
+        #else
+                    _mm256_stream_ps(dst, _reg);
+        #endif
+                }
+                else if constexpr (std::is_same_v<T, symd::bfloat16>)
+                {
+        #ifdef SYMD_AVX512
+                    __m256i shorts = _mm512_cvtepi32_epi16(_mm512_srli_epi32(_mm512_castps_si512(_reg), 16));
+                    _mm256_stream_si256((__m256i*)dst, shorts);
+        #else
+                    __m256i shorts = _mm256_packus_epi32(
+                        _mm256_srli_epi32(_mm256_castps_si256(_reg), 16),
+                        _mm256_setzero_si256());
+                    __m256i packed = _mm256_permute4x64_epi64(shorts, 0b00001000);
+                    _mm_stream_si128((__m128i*)dst, _mm256_castsi256_si128(packed));
+        #endif
+                }
+                else if constexpr (std::is_same_v<T, int>)
+                {
+        #ifdef SYMD_AVX512
+                    _mm512_stream_si512((__m512i*)dst, _reg);
+        #else
+                    _mm256_stream_si256((__m256i*)dst, _reg);
+        #endif
+                }
+                else if constexpr (std::is_same_v<T, unsigned char>)
+                {
+        #ifdef SYMD_AVX512
+                    _mm_stream_si128((__m128i*)dst, _reg);
+        #elif defined(__x86_64__) || defined(_M_X64)
+                    // 64-bit non-temporal store is x64 only, MSVC names it _mm_stream_si64x
+            #ifdef _MSC_VER
+                    _mm_stream_si64x((long long*)dst, _mm_cvtsi128_si64(_reg));
+            #else
+                    _mm_stream_si64((long long*)dst, _mm_cvtsi128_si64(_reg));
+            #endif
+        #else
+                    // 8 bytes are only half of 128-bit streaming store, so 32-bit x86 uses regular store
+                    store(dst);
+        #endif
+                }
+                else if constexpr (is_16bit_int<T>)
+                {
+        #ifdef SYMD_AVX512
+                    _mm256_stream_si256((__m256i*)dst, _reg);
+        #else
+                    _mm_stream_si128((__m128i*)dst, _reg);
+        #endif
+                }
+                else if constexpr (std::is_same_v<T, double>)
+                {
+        #ifdef SYMD_AVX512
+                    _mm512_stream_pd(dst + 0, _reg[0]);
+                    _mm512_stream_pd(dst + 8, _reg[1]);
+        #else
+                    _mm256_stream_pd(dst + 0, _reg[0]);
+                    _mm256_stream_pd(dst + 4, _reg[1]);
+        #endif
+                }
+    #else
+                // NEON has no non-temporal store intrinsics
+                store(dst);
+    #endif
+            }
+
+            // Stores only first count elements. Memory after dst + count is not touched.
+            void store(T* dst, int count) const
+            {
+                assert(count >= 0 && count <= SYMD_LEN);
+
+    #ifdef SYMD_AVX512
+                __mmask16 mask = _first_lanes_kmask(count);
+
+                if constexpr (std::is_same_v<T, float>)
+                {
+                    _mm512_mask_storeu_ps(dst, mask, _reg);
+                }
+                else if constexpr (std::is_same_v<T, symd::bfloat16>)
+                {
+                    __m256i shorts = _mm512_cvtepi32_epi16(_mm512_srli_epi32(_mm512_castps_si512(_reg), 16));
+                    _mm256_mask_storeu_epi16(dst, mask, shorts);
+                }
+                else if constexpr (std::is_same_v<T, int>)
+                {
+                    _mm512_mask_storeu_epi32(dst, mask, _reg);
+                }
+                else if constexpr (std::is_same_v<T, double>)
+                {
+                    _mm512_mask_storeu_pd(dst + 0, (__mmask8)mask, _reg[0]);
+                    _mm512_mask_storeu_pd(dst + 8, (__mmask8)(mask >> 8), _reg[1]);
+                }
+                else if constexpr (std::is_same_v<T, unsigned char>)
+                {
+                    _mm_mask_storeu_epi8(dst, mask, _reg);
+                }
+                else if constexpr (is_16bit_int<T>)
+                {
+                    _mm256_mask_storeu_epi16(dst, mask, _reg);
+                }
+                else
+    #elif defined SYMD_SSE
+                if constexpr (std::is_same_v<T, float>)
+                {
+                    _mm256_maskstore_ps(dst, first_lanes_mask(count)._int_mask(), _reg);
+                }
+                else if constexpr (std::is_same_v<T, int>)
+                {
+                    _mm256_maskstore_epi32(dst, first_lanes_mask(count)._reg, _reg);
+                }
+                else if constexpr (std::is_same_v<T, double>)
+                {
+                    auto mask = first_lanes_mask(count);
+
+                    _mm256_maskstore_pd(dst + 0, _mm256_castpd_si256(mask._reg[0]), _reg[0]);
+                    _mm256_maskstore_pd(dst + 4, _mm256_castpd_si256(mask._reg[1]), _reg[1]);
+                }
+                else
+    #endif
+                {
+                    // 8 and 16 bit types have no masked stores - go through buffer
+                    T buffer[SYMD_LEN];
+                    store(buffer);
+
+                    std::memcpy((void*)dst, buffer, count * sizeof(T));
+                }
+            }
+
             typename UnderlyingRegister<T>::DType operator[](size_t ind) const
             {
                 return _ptrToData[ind];
             }
 
 
+            /////////////////////////////////////////////////////////////////////////////////////
+            // Horizontal reductions - combine all elements of register in one value
+            /////////////////////////////////////////////////////////////////////////////////////
+
+            // Sum of all elements. Integer sums wrap around like register addition.
+            T hsum() const
+            {
+                return horizontal<HorizontalOp::add>();
+            }
+
+            // Product of all elements.
+            T hprod() const
+            {
+                return horizontal<HorizontalOp::mul>();
+            }
+
+            // Minimum of all elements.
+            T hmin() const
+            {
+                return horizontal<HorizontalOp::min>();
+            }
+
+            // Maximum of all elements.
+            T hmax() const
+            {
+                return horizontal<HorizontalOp::max>();
+            }
+
+            // Bitwise and of all elements. Integer types only.
+            T hand() const
+            {
+                return horizontal<HorizontalOp::bit_and>();
+            }
+
+            // Bitwise or of all elements. Integer types only.
+            T hor() const
+            {
+                return horizontal<HorizontalOp::bit_or>();
+            }
+
+
             /////////////////////////////////////////////////////////////////////////////////////
             // Conversions
             /////////////////////////////////////////////////////////////////////////////////////
@@ -1212,7 +2664,9 @@ namespace symd
                     && std::is_same_v<R, int>)
                 {
                     // Float,bfloat16 -> int ------------------------------------------------------------
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _mm512_cvtps_epi32(_reg);
+    #elif defined SYMD_SSE
                     return _mm256_cvtps_epi32(_reg);
     #elif defined SYMD_NEON
                     return vcvtq_s32_f32(_reg);
@@ -1228,7 +2682,13 @@ namespace symd
                     && std::is_same_v<R, double>)
                 {
                     // Float,bfloat16 -> Double ------------------------------------------------------------
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    __m256 hi = _mm512_extractf32x8_ps(_reg, 1);
+                    __m256 lo = _mm512_castps512_ps256(_reg);
+
+                    return typename UnderlyingRegister<double>::Type{ _mm512_cvtps_pd(lo), _mm512_cvtps_pd(hi) };
+
+    #elif defined SYMD_SSE
                     __m128 hi = _mm256_extractf128_ps(_reg, 1);
                     __m128 lo = _mm256_castps256_ps128(_reg);
 
@@ -1245,7 +2705,9 @@ namespace symd
                     (std::is_same_v<R, float> || std::is_same_v<R, symd::bfloat16>))
                 {
                     // Double -> Float,bfloat16 ------------------------------------------------------------
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _mm512_insertf32x8(_mm512_castps256_ps512(_mm512_cvtpd_ps(_reg[0])), _mm512_cvtpd_ps(_reg[1]), 1);
+    #elif defined SYMD_SSE
                     return _mm256_set_m128(_mm256_cvtpd_ps(_reg[1]), _mm256_cvtpd_ps(_reg[0]));
     #elif defined SYMD_NEON
 
@@ -1255,7 +2717,13 @@ namespace symd
                 else if constexpr (std::is_same_v<T, double> && std::is_same_v<R, int>)
                 {
                     // Double -> int ------------------------------------------------------------
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    __m256i lo = _mm512_cvtpd_epi32(_reg[0]);
+                    __m256i hi = _mm512_cvtpd_epi32(_reg[1]);
+
+                    return _mm512_inserti64x4(_mm512_castsi256_si512(lo), hi, 1);
+
+    #elif defined SYMD_SSE
                     __m128i lo = _mm256_cvtpd_epi32(_reg[0]);
                     __m128i hi = _mm256_cvtpd_epi32(_reg[1]);
 
@@ -1277,7 +2745,9 @@ namespace symd
                     (std::is_same_v<R, float> || std::is_same_v<R, symd::bfloat16>))
                 {
                     // Int -> float,bfloat16 ------------------------------------------------------------
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _mm512_cvtepi32_ps(_reg);
+    #elif defined SYMD_SSE
                     return _mm256_cvtepi32_ps(_reg);
     #elif defined SYMD_NEON
                     return  avcvtq_f32_s32(_reg);
@@ -1286,7 +2756,11 @@ namespace symd
                 else if constexpr (std::is_same_v<T, int> && std::is_same_v<R, unsigned char>)
                 {
                     // Int -> unsigned char ------------------------------------------------------------
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    // Negative values saturate to 0 like with packus on AVX2
+                    return _mm512_cvtusepi32_epi8(_mm512_max_epi32(_reg, _mm512_setzero_si512()));
+
+    #elif defined SYMD_SSE
                     __m128i lo = _mm256_extractf128_si256(_reg, 0);
                     __m128i hi = _mm256_extractf128_si256(_reg, 1);
 
@@ -1302,7 +2776,10 @@ namespace symd
                 {
                     // Int -> double ------------------------------------------------------------
                     return typename UnderlyingRegister<double>::Type {
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                        _mm512_cvtepi32_pd(_mm512_castsi512_si256(_reg)),
+                        _mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(_reg, 1))
+    #elif defined SYMD_SSE
                         _mm256_cvtepi32_pd(_mm256_extractf128_si256(_reg, 0)),
                         _mm256_cvtepi32_pd(_mm256_extractf128_si256(_reg, 1))
     #elif defined SYMD_NEON
@@ -1320,7 +2797,10 @@ namespace symd
                 else if constexpr (std::is_same_v<T, unsigned char> && std::is_same_v<R, int>)
                 {
                     // unsigned char -> int ------------------------------------------------------------
-    #ifdef SYMD_SSE
+    #ifdef SYMD_AVX512
+                    return _mm512_cvtepu8_epi32(_reg);
+
+    #elif defined SYMD_SSE
                     __m128i zeros = _mm_setzero_si128();
                     __m128i shorts = _mm_cvtepu8_epi16(_reg);
 
@@ -1339,6 +2819,49 @@ namespace symd
                     // unsigned char -> double ------------------------------------------------------------
                     return this->convert_to<int>().template convert_to<double>();
                 }
+                else if constexpr (is_16bit_int<T> && std::is_same_v<R, int>)
+                {
+                    // int16_t, uint16_t -> int ------------------------------------------------------------
+                    constexpr bool isSigned = std::is_same_v<T, int16_t>;
+    #ifdef SYMD_AVX512
+                    return isSigned ? _mm512_cvtepi16_epi32(_reg) : _mm512_cvtepu16_epi32(_reg);
+    #elif defined SYMD_SSE
+                    return isSigned ? _mm256_cvtepi16_epi32(_reg) : _mm256_cvtepu16_epi32(_reg);
+    #elif defined SYMD_NEON
+                    if constexpr (isSigned)
+                        return vmovl_s16(_reg);
+                    else
+                        return vreinterpretq_s32_u32(vmovl_u16(_reg));
+    #endif
+                }
+                else if constexpr (std::is_same_v<T, int> && is_16bit_int<R>)
+                {
+                    // Int -> int16_t, uint16_t (saturating) ------------------------------------------------------------
+    #ifdef SYMD_AVX512
+                    if constexpr (std::is_same_v<R, int16_t>)
+                        return _mm512_cvtsepi32_epi16(_reg);
+                    else
+                        return _mm512_cvtusepi32_epi16(_mm512_max_epi32(_reg, _mm512_setzero_si512()));
+    #elif defined SYMD_SSE
+                    __m128i lo = _mm256_castsi256_si128(_reg);
+                    __m128i hi = _mm256_extracti128_si256(_reg, 1);
+
+                    if constexpr (std::is_same_v<R, int16_t>)
+                        return _mm_packs_epi32(lo, hi);
+                    else
+                        return _mm_packus_epi32(lo, hi);
+    #elif defined SYMD_NEON
+                    if constexpr (std::is_same_v<R, int16_t>)
+                        return vqmovn_s32(_reg);
+                    else
+                        return vqmovun_s32(_reg);
+    #endif
+                }
+                else if constexpr ((is_16bit_int<T> || is_16bit_int<R>) && !std::is_same_v<T, R>)
+                {
+                    // Other conversions of 16 bit integers go through int ------------------------------------------
+                    return this->convert_to<int>().template convert_to<R>();
+                }
                 else
                 {
                     return *this;
@@ -1514,6 +3037,7 @@ namespace symd
         {
             return SymdRegister<T>(first) != sec;
         }
+        } // SYMD_ISA_NAMESPACE
     } // __internal__
 } // symd
 
@@ -0,0 +1,177 @@
+#pragma once
+#include <new>
+#include <memory>
+#include <cassert>
+#include <algorithm>
+#include "symd_register.h"
+#include "../dimensions.h"
+
+
+namespace symd::__internal__
+{
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
+    constexpr size_t TENSOR_ALIGNMENT = 64;
+
+    /// <summary>
+    /// Row length in elements, multiple of 64 bytes and of vector width. 64 bytes also hold whole full width
+    /// register of unsigned char.
+    /// </summary>
+    template <typename T>
+    int64_t alignedRowLength(int64_t width)
+    {
+        constexpr int64_t alignedLength = TENSOR_ALIGNMENT / sizeof(T);
+        constexpr int64_t multiple = alignedLength > SYMD_LEN ? alignedLength : SYMD_LEN;
+        return (width + multiple - 1) / multiple * multiple;
+    }
+
+    /// <summary>
+    /// Pitch of shape with rows padded to alignedRowLength, so every row starts at 64 byte boundary.
+    /// </summary>
+    template <typename T>
+    Dimensions alignedPitch(const Dimensions& shape)
+    {
+        auto pitch = shape.native_pitch();
+        pitch.set_ith_dim(shape.num_dims() - 1, 1);
+
+        int64_t dimPitch = alignedRowLength<T>(shape[-1]);
+
+        for (int i = shape.num_dims() - 2; i >= 0; i--)
+        {
+            pitch.set_ith_dim(i, dimPitch);
+            dimPitch *= shape[i];
+        }
+
+        return pitch;
+    }
+
+    /// <summary>
+    /// Number of elements in memory of shape with alignedPitch, padding included.
+    /// </summary>
+    template <typename T>
+    int64_t alignedSize(const Dimensions& shape)
+    {
+        if (shape.num_dims() == 1)
+            return alignedRowLength<T>(shape[0]);
+
+        return alignedPitch<T>(shape)[0] * shape[0];
+    }
+    } // SYMD_ISA_NAMESPACE
+}
+
+namespace symd
+{
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
+    /// <summary>
+    /// Owning container of multidimensional data. Memory is aligned to 64 bytes and pitch of last dimension is padded
+    /// to multiple of vector width, so every row starts at 64 byte boundary and maps over tensors use aligned loads.
+    /// </summary>
+    template <typename T>
+    class Tensor
+    {
+        struct AlignedDeleter
+        {
+            void operator()(T* ptr) const
+            {
+                ::operator delete(ptr, std::align_val_t(ALIGNMENT));
+            }
+        };
+
+        std::unique_ptr<T, AlignedDeleter> _data;
+        Dimensions _shape;
+        Dimensions _pitch;
+
+    public:
+        static constexpr size_t ALIGNMENT = __internal__::TENSOR_ALIGNMENT;
+
+        /// <summary>
+        /// Allocates tensor of given shape, all elements are set to zero.
+        /// </summary>
+        /// <param name="shape">Shape of tensor in elements.</param>
+        explicit Tensor(const Dimensions& shape)
+            : _shape(shape)
+            , _pitch(__internal__::alignedPitch<T>(shape))
+        {
+            int64_t size = __internal__::alignedSize<T>(shape);
+
+            _data.reset(static_cast<T*>(::operator new(size * sizeof(T), std::align_val_t(ALIGNMENT))));
+            std::fill_n(_data.get(), size, T(0));
+        }
+
+        T* data()
+        {
+            return _data.get();
+        }
+
+        const T* data() const
+        {
+            return _data.get();
+        }
+
+        const Dimensions& shape() const
+        {
+            return _shape;
+        }
+
+        /// <summary>
+        /// Distance between neighbouring elements of each dimension (in elements). Padding makes it larger than
+        /// native pitch of shape.
+        /// </summary>
+        const Dimensions& pitch() const
+        {
+            return _pitch;
+        }
+
+        // Element access (slow)
+        T& operator[](const Dimensions& coords)
+        {
+            assert(coords.num_dims() == _shape.num_dims());
+
+            T* dst = _data.get();
+
+            for (int i = 0; i < coords.num_dims(); i++)
+            {
+                assert(coords[i] < _shape[i]);
+                dst += coords[i] * _pitch[i];
+            }
+
+            return *dst;
+        }
+
+        const T& operator[](const Dimensions& coords) const
+        {
+            return const_cast<Tensor&>(*this)[coords];
+        }
+    };
+    } // SYMD_ISA_NAMESPACE
+}
+
+namespace symd::__internal__
+{
+    template <typename T>
+    Dimensions getShape(const Tensor<T>& t)
+    {
+        return t.shape();
+    }
+
+    template <typename T>
+    Dimensions getPitch(const Tensor<T>& t)
+    {
+        return t.pitch();
+    }
+
+    template <typename T>
+    T* getDataPtr(Tensor<T>& t, const Dimensions& coords)
+    {
+        return &t[coords];
+    }
+
+    template <typename T>
+    const T* getDataPtr(const Tensor<T>& t, const Dimensions& coords)
+    {
+        return &t[coords];
+    }
+}
@@ -0,0 +1,224 @@
+#pragma once
+#include <new>
+#include <array>
+#include <mutex>
+#include <vector>
+#include <cassert>
+#include "data_view.h"
+#include "tensor.h"
+#include "row_cursor.h"
+
+
+namespace symd::__internal__
+{
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
+    template <typename T, int dim>
+    class PooledBuffer;
+    } // SYMD_ISA_NAMESPACE
+}
+
+namespace symd
+{
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
+    /// <summary>
+    /// Cache of aligned memory blocks for temporary buffers of multi-stage pipelines. Blocks are grouped in size
+    /// classes (powers of two), released buffers go back to the pool and are reused by next acquire of same size
+    /// class, so processing of frames after the first one does not allocate. Pool can be used from multiple threads.
+    /// </summary>
+    class TensorPool
+    {
+        template <typename T, int dim>
+        friend class __internal__::PooledBuffer;
+
+        // Smallest block is 64 bytes (one alignment unit), largest 2^63 bytes
+        static constexpr int MIN_SIZE_CLASS = 6;
+        static constexpr int NUM_SIZE_CLASSES = 64;
+
+        mutable std::mutex _mutex;
+        std::array<std::vector<void*>, NUM_SIZE_CLASSES> _freeBlocks;
+
+        size_t _numAllocations = 0;
+        size_t _numAcquired = 0;
+
+        static int sizeClass(size_t bytes)
+        {
+            int result = MIN_SIZE_CLASS;
+
+            while (((size_t)1 << result) < bytes)
+                result++;
+
+            return result;
+        }
+
+        void* acquireBlock(int sizeClass)
+        {
+            std::lock_guard<std::mutex> guard(_mutex);
+            _numAcquired++;
+
+            auto& blocks = _freeBlocks[sizeClass];
+
+            if (!blocks.empty())
+            {
+                void* block = blocks.back();
+                blocks.pop_back();
+                return block;
+            }
+
+            _numAllocations++;
+            return ::operator new((size_t)1 << sizeClass, std::align_val_t(__internal__::TENSOR_ALIGNMENT));
+        }
+
+        void releaseBlock(void* block, int sizeClass)
+        {
+            std::lock_guard<std::mutex> guard(_mutex);
+            assert(_numAcquired > 0);
+
+            _numAcquired--;
+            _freeBlocks[sizeClass].push_back(block);
+        }
+
+    public:
+        TensorPool() = default;
+
+        TensorPool(const TensorPool&) = delete;
+        TensorPool& operator=(const TensorPool&) = delete;
+
+        ~TensorPool()
+        {
+            // Buffers must not outlive their pool
+            assert(_numAcquired == 0);
+            clear();
+        }
+
+        /// <summary>
+        /// Returns buffer of given shape with rows aligned and padded the same way as in Tensor. Content of buffer is
+        /// not initialized. Buffer goes back to the pool when it is destroyed.
+        /// </summary>
+        /// <param name="shape">Shape of buffer in elements.</param>
+        template <typename T, int dim>
+        __internal__::PooledBuffer<T, dim> acquire(const Dimensions& shape)
+        {
+            assert(shape.num_dims() == dim);
+
+            int sizeClass = TensorPool::sizeClass(__internal__::alignedSize<T>(shape) * sizeof(T));
+            void* block = acquireBlock(sizeClass);
+
+            return __internal__::PooledBuffer<T, dim>(this, block, sizeClass, shape);
+        }
+
+        /// <summary>
+        /// Frees all cached blocks. Buffers which are still in use are not affected.
+        /// </summary>
+        void clear()
+        {
+            std::lock_guard<std::mutex> guard(_mutex);
+
+            for (int i = 0; i < NUM_SIZE_CLASSES; i++)
+            {
+                for (void* block : _freeBlocks[i])
+                    ::operator delete(block, std::align_val_t(__internal__::TENSOR_ALIGNMENT));
+
+                _freeBlocks[i].clear();
+            }
+        }
+
+        /// <summary>
+        /// Number of blocks allocated from heap since creation of the pool. Stays constant in steady state.
+        /// </summary>
+        size_t num_allocations() const
+        {
+            std::lock_guard<std::mutex> guard(_mutex);
+            return _numAllocations;
+        }
+    };
+    } // SYMD_ISA_NAMESPACE
+}
+
+namespace symd::__internal__
+{
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
+    /// <summary>
+    /// Buffer acquired from TensorPool. It is data_view of pooled memory, so it can be passed to symd methods as any
+    /// other data_view. Returns its memory to the pool on destruction.
+    /// </summary>
+    template <typename T, int dim>
+    class PooledBuffer : public views::data_view<T, dim>
+    {
+        TensorPool* _pool;
+        void* _block;
+        int _sizeClass;
+
+        void release()
+        {
+            if (_pool)
+                _pool->releaseBlock(_block, _sizeClass);
+
+            _pool = nullptr;
+        }
+
+    public:
+        PooledBuffer(TensorPool* pool, void* block, int sizeClass, const Dimensions& shape)
+            : views::data_view<T, dim>(static_cast<T*>(block), shape, alignedPitch<T>(shape))
+            , _pool(pool)
+            , _block(block)
+            , _sizeClass(sizeClass)
+        {
+        }
+
+        PooledBuffer(const PooledBuffer&) = delete;
+        PooledBuffer& operator=(const PooledBuffer&) = delete;
+
+        PooledBuffer(PooledBuffer&& other)
+            : views::data_view<T, dim>(other)
+            , _pool(other._pool)
+            , _block(other._block)
+            , _sizeClass(other._sizeClass)
+        {
+            other._pool = nullptr;
+        }
+
+        PooledBuffer& operator=(PooledBuffer&& other)
+        {
+            if (this != &other)
+            {
+                release();
+
+                views::data_view<T, dim>::operator=(other);
+                _pool = other._pool;
+                _block = other._block;
+                _sizeClass = other._sizeClass;
+
+                other._pool = nullptr;
+            }
+
+            return *this;
+        }
+
+        ~PooledBuffer()
+        {
+            release();
+        }
+    };
+
+    /// <summary>
+    /// Pooled buffers have aligned rows, same as Tensor.
+    /// </summary>
+    template <typename T, int dim>
+    auto rowCursor(PooledBuffer<T, dim>& buffer, const Dimensions& rowCoords)
+    {
+        return AlignedRowCursor<T>{ { getDataPtr(buffer, rowCoords), 1 } };
+    }
+
+    template <typename T, int dim>
+    auto rowCursor(const PooledBuffer<T, dim>& buffer, const Dimensions& rowCoords)
+    {
+        return AlignedRowCursor<const T>{ { getDataPtr(buffer, rowCoords), 1 } };
+    }
+    } // SYMD_ISA_NAMESPACE
+}
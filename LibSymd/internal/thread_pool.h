@@ -0,0 +1,361 @@
+#pragma once
+#include <thread>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <algorithm>
+#include <type_traits>
+#include <exception>
+#include <condition_variable>
+#include <map>
+
+#ifdef __linux__
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+
+namespace symd::__internal__
+{
+    /// <summary>
+    /// Persistent work-stealing thread pool. Used as default parallel backend of symd::map when
+    /// neither TBB nor std::execution are available. Threads are created once and reused for every call.
+    /// Unlike rest of Symd it is not in SYMD_ISA_NAMESPACE: it does not depend on register width and object files
+    /// compiled for different instruction sets share one set of pools and one counter of reserved cores.
+    /// </summary>
+    class ThreadPool
+    {
+        /// <summary>
+        /// One parallel_for call. Lives on the stack of the calling thread until all of its indices are done.
+        /// </summary>
+        struct Job
+        {
+            void (*invoke)(void* func, size_t ind);
+            void* func;
+
+            std::atomic<size_t> remaining;
+
+            std::mutex exceptionMutex;
+            std::exception_ptr exception;
+        };
+
+        /// <summary>
+        /// Range of indices [begin, end) of a Job. Ranges are split lazily, so idle workers can steal big chunks.
+        /// </summary>
+        struct Task
+        {
+            Job* job;
+            size_t begin;
+            size_t end;
+        };
+
+        /// <summary>
+        /// Tasks of one worker. Stolen tasks only advance front index, vector is cleared when queue runs empty,
+        /// so it keeps its capacity and parallel_for does not allocate. Splitting pushes about log2(count) tasks,
+        /// reserved capacity is enough for any realistic count.
+        /// </summary>
+        struct alignas(64) WorkerQueue
+        {
+            std::mutex mutex;
+            std::vector<Task> tasks;
+            size_t front = 0;
+
+            bool empty() const
+            {
+                return front == tasks.size();
+            }
+
+            void resetIfEmpty()
+            {
+                if (empty())
+                {
+                    tasks.clear();
+                    front = 0;
+                }
+            }
+        };
+
+        std::vector<std::unique_ptr<WorkerQueue>> _queues;
+        std::vector<std::thread> _workers;
+        std::vector<size_t> _pinnedCores;
+
+        std::atomic<size_t> _numQueued{ 0 };
+        std::mutex _sleepMutex;
+        std::condition_variable _wakeUp;
+        bool _stop = false;
+
+        void push(size_t queueInd, const Task& task)
+        {
+            {
+                std::lock_guard<std::mutex> guard(_queues[queueInd]->mutex);
+                _queues[queueInd]->tasks.push_back(task);
+                _numQueued++;
+            }
+
+            {
+                std::lock_guard<std::mutex> guard(_sleepMutex);
+            }
+
+            _wakeUp.notify_one();
+        }
+
+        // Owner takes the most recently pushed (smallest, cache hot) task from the back.
+        bool popOwn(size_t queueInd, Task& task)
+        {
+            auto& queue = *_queues[queueInd];
+            std::lock_guard<std::mutex> guard(queue.mutex);
+
+            if (queue.empty())
+                return false;
+
+            task = queue.tasks.back();
+            queue.tasks.pop_back();
+            queue.resetIfEmpty();
+            _numQueued--;
+
+            return true;
+        }
+
+        // Thieves take the oldest (biggest) task from the front of other queues.
+        bool steal(size_t firstQueueInd, Task& task)
+        {
+            for (size_t i = 0; i < _queues.size(); i++)
+            {
+                auto& queue = *_queues[(firstQueueInd + i) % _queues.size()];
+                std::lock_guard<std::mutex> guard(queue.mutex);
+
+                if (queue.empty())
+                    continue;
+
+                task = queue.tasks[queue.front++];
+                queue.resetIfEmpty();
+                _numQueued--;
+
+                return true;
+            }
+
+            return false;
+        }
+
+        /// <summary>
+        /// Executes task. Workers push upper halves of the range back to their own queue so others can steal them.
+        /// </summary>
+        void run(Task task, int queueInd)
+        {
+            if (queueInd >= 0)
+            {
+                while (task.end - task.begin > 1)
+                {
+                    size_t mid = task.begin + (task.end - task.begin) / 2;
+                    push(queueInd, Task{ task.job, mid, task.end });
+                    task.end = mid;
+                }
+            }
+
+            for (size_t i = task.begin; i < task.end; i++)
+            {
+                try
+                {
+                    task.job->invoke(task.job->func, i);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> guard(task.job->exceptionMutex);
+
+                    if (!task.job->exception)
+                        task.job->exception = std::current_exception();
+                }
+
+                task.job->remaining--;
+            }
+        }
+
+        void workerLoop(size_t queueInd)
+        {
+            while (true)
+            {
+                Task task;
+
+                if (popOwn(queueInd, task) || steal(queueInd + 1, task))
+                {
+                    run(task, (int)queueInd);
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(_sleepMutex);
+                _wakeUp.wait(lock, [this]() { return _stop || _numQueued > 0; });
+
+                if (_stop)
+                    return;
+            }
+        }
+
+        /// <summary>
+        /// Takes next count cores for workers of pinned pool. Pools take consecutive cores, so several pinned pools
+        /// do not share cores until all of them are used. Core 0 is left for thread calling parallel_for.
+        /// </summary>
+        static size_t reserveCores(size_t count)
+        {
+            static std::atomic<size_t> numReserved{ 0 };
+            return coreAfter(numReserved.fetch_add(count));
+        }
+
+        // Cores wrap around and skip core 0.
+        static size_t coreAfter(size_t core)
+        {
+            size_t numCores = std::max(1u, std::thread::hardware_concurrency());
+            return numCores > 1 ? 1 + core % (numCores - 1) : 0;
+        }
+
+        static void pinToCore(std::thread& worker, size_t core)
+        {
+#ifdef __linux__
+            cpu_set_t cpuSet;
+            CPU_ZERO(&cpuSet);
+            CPU_SET(core, &cpuSet);
+
+            pthread_setaffinity_np(worker.native_handle(), sizeof(cpu_set_t), &cpuSet);
+#endif
+        }
+
+    public:
+        /// <summary>
+        /// Creates pool with given number of worker threads. Thread calling parallel_for also participates in work.
+        /// </summary>
+        /// <param name="numWorkers">Number of background worker threads.</param>
+        /// <param name="pinThreads">Pin each worker thread to its own core (Linux only).</param>
+        explicit ThreadPool(size_t numWorkers, bool pinThreads = false)
+        {
+            for (size_t i = 0; i < numWorkers; i++)
+            {
+                _queues.push_back(std::make_unique<WorkerQueue>());
+                _queues.back()->tasks.reserve(64);
+            }
+
+            size_t core = pinThreads ? reserveCores(numWorkers) : 0;
+
+            for (size_t i = 0; i < numWorkers; i++)
+            {
+                _workers.emplace_back([this, i]() { workerLoop(i); });
+
+                if (pinThreads)
+                {
+                    pinToCore(_workers.back(), core);
+                    _pinnedCores.push_back(core);
+                    core = coreAfter(core);
+                }
+            }
+        }
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        ~ThreadPool()
+        {
+            {
+                std::lock_guard<std::mutex> guard(_sleepMutex);
+                _stop = true;
+            }
+
+            _wakeUp.notify_all();
+
+            for (auto& worker : _workers)
+                worker.join();
+        }
+
+        /// <summary>
+        /// Number of threads executing work (worker threads plus calling thread).
+        /// </summary>
+        size_t num_threads() const
+        {
+            return _workers.size() + 1;
+        }
+
+        /// <summary>
+        /// Cores of pinned worker threads, empty if threads are not pinned.
+        /// </summary>
+        const std::vector<size_t>& pinned_cores() const
+        {
+            return _pinnedCores;
+        }
+
+        /// <summary>
+        /// Calls func(i) for every i in [0, count) and waits for all calls to finish.
+        /// First exception thrown by func is rethrown on the calling thread.
+        /// </summary>
+        template <typename Func>
+        void parallel_for(size_t count, Func&& func)
+        {
+            if (count == 0)
+                return;
+
+            if (count == 1 || _workers.empty())
+            {
+                for (size_t i = 0; i < count; i++)
+                    func(i);
+
+                return;
+            }
+
+            Job job;
+            job.func = (void*)&func;
+            job.invoke = [](void* f, size_t ind) { (*(std::remove_reference_t<Func>*)f)(ind); };
+            job.remaining = count;
+
+            // Give every worker one contiguous chunk. Workers further split and steal as needed.
+            size_t numChunks = std::min(count, _workers.size());
+
+            for (size_t i = 0; i < numChunks; i++)
+                push(i, Task{ &job, count * i / numChunks, count * (i + 1) / numChunks });
+
+            // Calling thread helps until the job is finished.
+            while (job.remaining > 0)
+            {
+                Task task;
+
+                if (steal(0, task))
+                    run(task, -1);
+                else
+                    std::this_thread::yield();
+            }
+
+            if (job.exception)
+                std::rethrow_exception(job.exception);
+        }
+
+        /// <summary>
+        /// Process wide pool with one thread per hardware core. Created on first use.
+        /// </summary>
+        static ThreadPool& instance()
+        {
+            static ThreadPool pool(std::max(1u, std::thread::hardware_concurrency()) - 1);
+            return pool;
+        }
+
+        /// <summary>
+        /// Process wide pool with given number of threads. One pool per configuration is created on first use and reused later.
+        /// </summary>
+        /// <param name="numThreads">Total number of threads including calling thread. 0 means one per hardware core.</param>
+        /// <param name="pinThreads">Pin worker threads to cores.</param>
+        static ThreadPool& instance(int numThreads, bool pinThreads)
+        {
+            if (numThreads <= 0)
+                numThreads = std::max(1u, std::thread::hardware_concurrency());
+
+            if (!pinThreads && numThreads == (int)std::max(1u, std::thread::hardware_concurrency()))
+                return instance();
+
+            static std::mutex poolsMutex;
+            static std::map<std::pair<int, bool>, std::unique_ptr<ThreadPool>> pools;
+
+            std::lock_guard<std::mutex> guard(poolsMutex);
+            auto& pool = pools[{ numThreads, pinThreads }];
+
+            if (!pool)
+                pool = std::make_unique<ThreadPool>(numThreads - 1, pinThreads);
+
+            return *pool;
+        }
+    };
+}
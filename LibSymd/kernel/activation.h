@@ -0,0 +1,171 @@
+#pragma once
+#include "../internal/symd_register.h"
+#include "convert_to.h"
+#include "blend.h"
+#include "fma.h"
+#include "exp.h"
+#include <algorithm>
+#include <cmath>
+
+
+namespace symd::kernel
+{
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
+    namespace __internal_activation
+    {
+        using __internal_exp::ElementType;
+
+        // exp(x) for x <= 0. Clamped so 2^n of fastpow2 stays in normal range of float.
+        template <typename T>
+        T exp_nonpositive(const T& x)
+        {
+            using DType = typename ElementType<T>::type;
+            return exp(std::max(x, (DType)-80.0));
+        }
+
+        // log(1 + u) for u in [0, 1] as 2 * atanh(s), s = u / (2 + u) in [0, 1/3]. Error below 1e-9.
+        template <typename T>
+        T log1p_unit(const T& u)
+        {
+            using DType = typename ElementType<T>::type;
+
+            T s = u / (u + (DType)2.0);
+            T s2 = s * s;
+
+            T p = fma(s2, (DType)(2.0 / 15.0), (DType)(2.0 / 13.0));
+            p = fma(p, s2, (DType)(2.0 / 11.0));
+            p = fma(p, s2, (DType)(2.0 / 9.0));
+            p = fma(p, s2, (DType)(2.0 / 7.0));
+            p = fma(p, s2, (DType)(2.0 / 5.0));
+            p = fma(p, s2, (DType)(2.0 / 3.0));
+            p = fma(p, s2, (DType)2.0);
+
+            return p * s;
+        }
+
+        template <typename T>
+        T sigmoid_impl(const T& x)
+        {
+            using DType = typename ElementType<T>::type;
+
+            // 1 / (1 + e^-x) for x >= 0 and e^x / (1 + e^x) for x < 0 never overflow
+            T e = exp_nonpositive(-std::abs(x));
+            T r = (DType)1.0 / (e + (DType)1.0);
+
+            return blend(x < (DType)0.0, e * r, r);
+        }
+
+        template <typename T>
+        T tanh_impl(const T& x)
+        {
+            using DType = typename ElementType<T>::type;
+
+            // tanh(|x|) = (1 - e^-2|x|) / (1 + e^-2|x|)
+            T e = exp_nonpositive(std::abs(x) * (DType)-2.0);
+            T t = ((DType)1.0 - e) / (e + (DType)1.0);
+
+            return blend(x < (DType)0.0, -t, t);
+        }
+
+        template <typename T>
+        T erf_impl(const T& x)
+        {
+            using DType = typename ElementType<T>::type;
+
+            // Abramowitz and Stegun 7.1.26, absolute error 1.5e-7
+            T a = std::abs(x);
+            T t = (DType)1.0 / fma(a, (DType)0.3275911, (DType)1.0);
+
+            T p = fma(t, (DType)1.061405429, (DType)-1.453152027);
+            p = fma(p, t, (DType)1.421413741);
+            p = fma(p, t, (DType)-0.284496736);
+            p = fma(p, t, (DType)0.254829592);
+
+            T e = (DType)1.0 - p * t * exp_nonpositive(-(a * a));
+
+            return blend(x < (DType)0.0, -e, e);
+        }
+
+        template <typename T>
+        T softplus_impl(const T& x)
+        {
+            using DType = typename ElementType<T>::type;
+
+            // log(1 + e^x) = max(x, 0) + log(1 + e^-|x|)
+            return std::max(x, (DType)0.0) + log1p_unit(exp_nonpositive(-std::abs(x)));
+        }
+
+        template <typename T>
+        T gelu_impl(const T& x)
+        {
+            using DType = typename ElementType<T>::type;
+
+            // 0.5 * x * (1 + erf(x / sqrt(2)))
+            T h = x * (DType)0.5;
+            return fma(h, erf_impl(x * (DType)0.70710678118654752440), h);
+        }
+
+        template <typename T>
+        T gelu_tanh_impl(const T& x)
+        {
+            using DType = typename ElementType<T>::type;
+
+            // 0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3)))
+            T h = x * (DType)0.5;
+            T inner = fma(x * x, (DType)0.044715, (DType)1.0) * x * (DType)0.79788456080286535588;
+
+            return fma(h, tanh_impl(inner), h);
+        }
+    }
+
+
+    /// Computes logistic sigmoid 1 / (1 + e^-x). Relative error follows kernel::exp (about 1e-5).
+    template <typename T>
+    T sigmoid(T x)
+    {
+        return __internal_exp::compute_bfloat16_in_float(x, [](const auto& v) { return __internal_activation::sigmoid_impl(v); });
+    }
+
+
+    /// Computes hyperbolic tangent of x. Absolute error follows kernel::exp (about 1e-5).
+    template <typename T>
+    T tanh(T x)
+    {
+        return __internal_exp::compute_bfloat16_in_float(x, [](const auto& v) { return __internal_activation::tanh_impl(v); });
+    }
+
+
+    /// Computes error function of x with Abramowitz-Stegun approximation. Absolute error about 1e-5.
+    template <typename T>
+    T erf(T x)
+    {
+        return __internal_exp::compute_bfloat16_in_float(x, [](const auto& v) { return __internal_activation::erf_impl(v); });
+    }
+
+
+    /// Computes softplus log(1 + e^x) without overflow for large x.
+    template <typename T>
+    T softplus(T x)
+    {
+        return __internal_exp::compute_bfloat16_in_float(x, [](const auto& v) { return __internal_activation::softplus_impl(v); });
+    }
+
+
+    /// Computes GELU x * Phi(x) with Phi evaluated through erf.
+    template <typename T>
+    T gelu(T x)
+    {
+        return __internal_exp::compute_bfloat16_in_float(x, [](const auto& v) { return __internal_activation::gelu_impl(v); });
+    }
+
+
+    /// Computes tanh approximation of GELU 0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3))).
+    template <typename T>
+    T gelu_tanh(T x)
+    {
+        return __internal_exp::compute_bfloat16_in_float(x, [](const auto& v) { return __internal_activation::gelu_tanh_impl(v); });
+    }
+    } // SYMD_ISA_NAMESPACE
+}
@@ -1,5 +1,11 @@
 #pragma once
+#include "activation.h"
 #include "blend.h"
 #include "convert_to.h"
+#include "fma.h"
+#include "full_width.h"
 #include "exp.h"
-#include "log.h"
\ No newline at end of file
+#include "horizontal.h"
+#include "log.h"
+#include "saturating.h"
+#include "trigonometric.h"
\ No newline at end of file
@@ -5,6 +5,9 @@
 
 namespace symd::kernel
 {
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
     /// <summary>
     /// According to selector blends first and second parameters. Similar to ternary operator.
     /// </summary>
@@ -50,4 +53,5 @@ namespace symd::kernel
         static_assert(__internal__::UnderlyingRegister<T>::is_supported_type(), "Unsupported type.");
         return selector ? first : second;
     }
+    } // SYMD_ISA_NAMESPACE
 } // kernel
@@ -5,6 +5,9 @@
 
 namespace symd::kernel
 {
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
     /// <summary>
     /// Converts data from one scalar format to another (float -> int).
     /// </summary>
@@ -28,7 +31,7 @@ namespace symd::kernel
         else
         {
             // When converting to integral types check limits
-            if constexpr (std::is_same_v<R, int> || std::is_same_v<R, unsigned char>)
+            if constexpr (std::is_integral_v<R>)
             {
                 if (x > std::numeric_limits<R>::max())
                     return std::numeric_limits<R>::max();
@@ -53,4 +56,5 @@ namespace symd::kernel
 
         return in.template convert_to<R>();
     }
+    } // SYMD_ISA_NAMESPACE
 } // kernel
@@ -1,12 +1,19 @@
 #pragma once
 #include "../internal/symd_register.h"
+#include "../accuracy.h"
+#include "convert_to.h"
+#include "fma.h"
+#include <algorithm>
 #include <cmath>
 
 
 namespace symd::kernel
 {
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
     // Function to extract the exponent from a single-precision floating-point number in IEEE 754 format.
-    int fp_exp(float x)
+    inline int fp_exp(float x)
     {
         // Reinterpret the float bits as an unsigned int
         unsigned int as_int = *((unsigned int*)(&x));
@@ -15,14 +22,14 @@ namespace symd::kernel
         return ((as_int << 1) >> 24) - 127;
     }
 
-    __internal__::SymdRegister<int> fp_exp(const __internal__::SymdRegister<float>& x)
+    inline __internal__::SymdRegister<int> fp_exp(const __internal__::SymdRegister<float>& x)
     {
         return x.fp_exp();
     }
 
     // Returns a new float with the same exponent as the input float, but with a significant part of zero.
     // This effectively extracts the exponent part of the input float.
-    float exp_part_of_float(float x)
+    inline float exp_part_of_float(float x)
     {
         if (x == 0)
             return 0;
@@ -40,7 +47,7 @@ namespace symd::kernel
         return *((float*)(&as_int));
     }
 
-    __internal__::SymdRegister<float> exp_part_of_float(const __internal__::SymdRegister<float>& x)
+    inline __internal__::SymdRegister<float> exp_part_of_float(const __internal__::SymdRegister<float>& x)
     {
         return blend(x == 0.0f, __internal__::SymdRegister<float>(0.0f), x.exp_part_of_float());
     }
@@ -48,33 +55,17 @@ namespace symd::kernel
     namespace __internal_exp
     { 
         // http://spfrnd.de/posts/2018-03-10-fast-exponential.html
+        // Taylor series up to x^6 / 6!, evaluated with Horner scheme.
         template<typename DType, typename T>
         T exp_teylor(T x)
         {
-            auto term = x;
-        
-            auto eValue = term + (DType)1.0;
-            term = term * x * (DType)0.5;
-
-            eValue += term;
-            term = term * x * (DType)0.33333333333;
-
-            eValue += term;
-            term = term * x * (DType)0.25;
-
-            eValue += term;
-            term = term * x * (DType)0.2;
-
-            eValue += term;
-            term = term * x * (DType)0.16666666666;
-
-            eValue += term;
-            term = term * x * (DType)0.14285714285;
-
-            // eValue += term;
-            // term = term * x / 8;
+            auto p = fma(x, (DType)(1.0 / 720.0), (DType)(1.0 / 120.0));
+            p = fma(p, x, (DType)(1.0 / 24.0));
+            p = fma(p, x, (DType)(1.0 / 6.0));
+            p = fma(p, x, (DType)0.5);
+            p = fma(p, x, (DType)1.0);
 
-            return eValue;
+            return fma(p, x, (DType)1.0);
         }
 
         // Calculates 2^n with integer exponent by bit ops to set exponent field of float.
@@ -130,6 +121,133 @@ namespace symd::kernel
         {
             return fastpow2f_impl<T, __internal__::SymdRegister<T>>(x);
         }
+
+        // Scalar type of scalar or register, used to pick constants of right precision.
+        template <typename T>
+        struct ElementType
+        {
+            using type = T;
+        };
+
+        template <typename T>
+        struct ElementType<__internal__::SymdRegister<T>>
+        {
+            using type = T;
+        };
+
+        // Evaluates func in float for bfloat16 scalars and registers, because bfloat16 constants would lose precision.
+        template <typename T, typename Func>
+        T compute_bfloat16_in_float(const T& x, Func&& func)
+        {
+            if constexpr (std::is_same_v<T, symd::bfloat16>)
+                return symd::bfloat16(func((float)x));
+            else
+                return func(x);
+        }
+
+        template <typename T, typename Func>
+        __internal__::SymdRegister<T> compute_bfloat16_in_float(const __internal__::SymdRegister<T>& x, Func&& func)
+        {
+            if constexpr (std::is_same_v<T, symd::bfloat16>)
+                return convert_to<symd::bfloat16>(func(convert_to<float>(x)));
+            else
+                return func(x);
+        }
+
+        template <typename DType>
+        struct ExpConstants;
+
+        template <>
+        struct ExpConstants<float>
+        {
+            // 1.5 * 2^23, adding and subtracting it rounds float to nearest integer
+            static constexpr float round_magic = 12582912.0f;
+            static constexpr float log2e = 1.44269504088896341f;
+
+            // ln(2) split so n * ln2_hi is exact
+            static constexpr float ln2_hi = 0.693359375f;
+            static constexpr float ln2_lo = -2.12194440e-4f;
+
+            // Results outside of this range are 0 or inf
+            static constexpr float min_x = -104.0f;
+            static constexpr float max_x = 89.0f;
+
+            static constexpr int fast_degree = 3;
+            static constexpr int precise_degree = 7;
+        };
+
+        template <>
+        struct ExpConstants<double>
+        {
+            // 1.5 * 2^52, adding and subtracting it rounds double to nearest integer
+            static constexpr double round_magic = 6755399441055744.0;
+            static constexpr double log2e = 1.44269504088896340736;
+
+            // ln(2) split so n * ln2_hi is exact
+            static constexpr double ln2_hi = 6.93147180369123816490e-01;
+            static constexpr double ln2_lo = 1.90821492927058770002e-10;
+
+            // Results outside of this range are 0 or inf
+            static constexpr double min_x = -745.5;
+            static constexpr double max_x = 710.0;
+
+            static constexpr int fast_degree = 3;
+            static constexpr int precise_degree = 13;
+        };
+
+        // Rounds to nearest integer (ties to even). Valid for |x| < 2^22 (float) or 2^51 (double).
+        template <typename DType, typename T>
+        T round_nearest(const T& x)
+        {
+            return (x + ExpConstants<DType>::round_magic) - ExpConstants<DType>::round_magic;
+        }
+
+        constexpr double inverse_factorial(int n)
+        {
+            return n <= 1 ? 1.0 : inverse_factorial(n - 1) / n;
+        }
+
+        // Taylor series of e^r up to r^Degree / Degree!, evaluated with Horner scheme.
+        template <typename DType, int Degree, typename T>
+        T exp_taylor_horner(const T& r)
+        {
+            T p = fma(r, (DType)inverse_factorial(Degree), (DType)inverse_factorial(Degree - 1));
+
+            for (int k = Degree - 2; k >= 0; k--)
+                p = fma(p, r, (DType)inverse_factorial(k));
+
+            return p;
+        }
+
+        // e^x = 2^n * e^r, n = round(x / ln2), |r| <= ln2 / 2. Fast tier subtracts n * ln2 in one step,
+        // precise tier in two (Cody-Waite) so r keeps full precision for large n.
+        template <typename Accuracy, typename T>
+        T exp_reduced(T x)
+        {
+            using DType = typename ElementType<T>::type;
+            using C = ExpConstants<DType>;
+
+            x = std::min(std::max(x, C::min_x), C::max_x);
+            T n = round_nearest<DType>(x * C::log2e);
+            T p;
+
+            if constexpr (std::is_same_v<Accuracy, symd::precise>)
+            {
+                T r = fma(n, -C::ln2_hi, x);
+                r = fma(n, -C::ln2_lo, r);
+                p = exp_taylor_horner<DType, C::precise_degree>(r);
+            }
+            else
+            {
+                T r = fma(n, (DType)-0.69314718055994530942, x);
+                p = exp_taylor_horner<DType, C::fast_degree>(r);
+            }
+
+            // 2^n in two halves, so results near max float and subnormal results are not lost
+            T half = round_nearest<DType>(n * (DType)0.5);
+
+            return p * fastpow2<DType>(convert_to<int>(half)) * fastpow2<DType>(convert_to<int>(n - half));
+        }
     }
 
 
@@ -143,10 +261,27 @@ namespace symd::kernel
 
 
     /// Computes e (Euler's number) raised to the power of x.
-    template <typename T>
+    /// Accuracy tiers (float):
+    ///     symd::fast      - relative error below 1e-3.
+    ///     symd::standard  - relative error below 5e-5. Default.
+    ///     symd::precise   - error below 2 ULP in normal range (float and double).
+    template <typename Accuracy = symd::standard, typename T>
     T exp(T x)
     {
-        // e^x = 2^(x / 0.69314718056f)
-        return __internal_exp::fastpow2f(x / (T)0.69314718056);
+        if constexpr (std::is_same_v<Accuracy, symd::standard>)
+        {
+            // e^x = 2^(x / 0.69314718056f)
+            return __internal_exp::fastpow2f(x / (T)0.69314718056);
+        }
+        else
+        {
+            static_assert(std::is_same_v<Accuracy, symd::fast> || std::is_same_v<Accuracy, symd::precise>, "Unknown accuracy tier.");
+
+            return __internal_exp::compute_bfloat16_in_float(x, [](const auto& v)
+                {
+                    return __internal_exp::exp_reduced<Accuracy>(v);
+                });
+        }
     }
+    } // SYMD_ISA_NAMESPACE
 }
@@ -0,0 +1,94 @@
+#pragma once
+#include "../internal/symd_register.h"
+#include <cmath>
+
+
+namespace symd::kernel
+{
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
+    namespace __internal_fma
+    {
+        // Keeps scalar arguments out of template deduction, so float constants can be used with bfloat16 registers.
+        template <typename T>
+        struct scalar
+        {
+            using type = T;
+        };
+    }
+
+    /// <summary>
+    /// Computes a * b + c. Uses fused multiply-add (single rounding) when CPU has it (SYMD_FMA).
+    /// Polynomials evaluated with chain of fma (Horner scheme) are faster and more accurate.
+    /// </summary>
+    template <typename T>
+    inline T fma(T a, T b, T c)
+    {
+        static_assert(__internal__::UnderlyingRegister<T>::is_supported_type(), "Unsupported type.");
+
+#ifdef SYMD_FMA
+        if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
+            return std::fma(a, b, c);
+        else
+            return a * b + c;
+#else
+        return a * b + c;
+#endif
+    }
+
+    template <typename T>
+    inline __internal__::SymdRegister<T> fma(
+        const __internal__::SymdRegister<T>& a,
+        const __internal__::SymdRegister<T>& b,
+        const __internal__::SymdRegister<T>& c)
+    {
+        return a.fmadd(b, c);
+    }
+
+    template <typename T>
+    inline __internal__::SymdRegister<T> fma(
+        const __internal__::SymdRegister<T>& a,
+        const __internal__::SymdRegister<T>& b,
+        typename __internal_fma::scalar<T>::type c)
+    {
+        return a.fmadd(b, __internal__::SymdRegister<T>(c));
+    }
+
+    template <typename T>
+    inline __internal__::SymdRegister<T> fma(
+        const __internal__::SymdRegister<T>& a,
+        typename __internal_fma::scalar<T>::type b,
+        const __internal__::SymdRegister<T>& c)
+    {
+        return a.fmadd(__internal__::SymdRegister<T>(b), c);
+    }
+
+    template <typename T>
+    inline __internal__::SymdRegister<T> fma(
+        const __internal__::SymdRegister<T>& a,
+        typename __internal_fma::scalar<T>::type b,
+        typename __internal_fma::scalar<T>::type c)
+    {
+        return a.fmadd(__internal__::SymdRegister<T>(b), __internal__::SymdRegister<T>(c));
+    }
+
+    template <typename T>
+    inline __internal__::SymdRegister<T> fma(
+        typename __internal_fma::scalar<T>::type a,
+        const __internal__::SymdRegister<T>& b,
+        const __internal__::SymdRegister<T>& c)
+    {
+        return b.fmadd(__internal__::SymdRegister<T>(a), c);
+    }
+
+    template <typename T>
+    inline __internal__::SymdRegister<T> fma(
+        typename __internal_fma::scalar<T>::type a,
+        const __internal__::SymdRegister<T>& b,
+        typename __internal_fma::scalar<T>::type c)
+    {
+        return b.fmadd(__internal__::SymdRegister<T>(a), __internal__::SymdRegister<T>(c));
+    }
+    } // SYMD_ISA_NAMESPACE
+} // kernel
@@ -0,0 +1,388 @@
+#pragma once
+#include "../internal/full_width_register.h"
+#include "activation.h"
+#include "blend.h"
+#include "convert_to.h"
+#include "exp.h"
+#include "fma.h"
+#include "horizontal.h"
+#include "log.h"
+#include "saturating.h"
+#include "trigonometric.h"
+
+
+namespace symd::kernel
+{
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
+    // Overloads of kernel functions for FullWidthRegister and RegisterPack. Maps over unsigned char only pass
+    // FullWidthRegister to kernels, its conversions to other types give RegisterPack (see full_width_register.h).
+    // Pack functions apply the SymdRegister version to every part.
+
+    /////////////////////////////////////////////////////////////////////////////////////
+    // Conversions
+    /////////////////////////////////////////////////////////////////////////////////////
+
+    template <typename R, typename T>
+    inline auto convert_to(const __internal__::FullWidthRegister<T>& in)
+    {
+        static_assert(__internal__::UnderlyingRegister<R>::is_supported_type(), "Unsupported type.");
+        return in.template convert_to<R>();
+    }
+
+    template <typename R, typename T, int N>
+    inline auto convert_to(const __internal__::RegisterPack<T, N>& in)
+    {
+        static_assert(__internal__::UnderlyingRegister<R>::is_supported_type(), "Unsupported type.");
+        return in.template convert_to<R>();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////
+    // Blend
+    /////////////////////////////////////////////////////////////////////////////////////
+
+    template <typename T>
+    inline __internal__::FullWidthRegister<T> blend(
+        const __internal__::FullWidthRegister<T>& selector,
+        const __internal__::FullWidthRegister<T>& first,
+        const __internal__::FullWidthRegister<T>& second)
+    {
+        return selector.blend(first, second);
+    }
+
+    template <typename T>
+    inline __internal__::FullWidthRegister<T> blend(
+        const __internal__::FullWidthRegister<T>& selector,
+        const __internal__::FullWidthRegister<T>& first,
+        const T& second)
+    {
+        return selector.blend(first, __internal__::FullWidthRegister<T>(second));
+    }
+
+    template <typename T>
+    inline __internal__::FullWidthRegister<T> blend(
+        const __internal__::FullWidthRegister<T>& selector,
+        const T& first,
+        const __internal__::FullWidthRegister<T>& second)
+    {
+        return selector.blend(__internal__::FullWidthRegister<T>(first), second);
+    }
+
+    template <typename T, int N>
+    inline __internal__::RegisterPack<T, N> blend(
+        const __internal__::RegisterPack<T, N>& selector,
+        const __internal__::RegisterPack<T, N>& first,
+        const __internal__::RegisterPack<T, N>& second)
+    {
+        return selector.blend(first, second);
+    }
+
+    template <typename T, int N>
+    inline __internal__::RegisterPack<T, N> blend(
+        const __internal__::RegisterPack<T, N>& selector,
+        const __internal__::RegisterPack<T, N>& first,
+        const T& second)
+    {
+        return selector.blend(first, __internal__::RegisterPack<T, N>(second));
+    }
+
+    template <typename T, int N>
+    inline __internal__::RegisterPack<T, N> blend(
+        const __internal__::RegisterPack<T, N>& selector,
+        const T& first,
+        const __internal__::RegisterPack<T, N>& second)
+    {
+        return selector.blend(__internal__::RegisterPack<T, N>(first), second);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////
+    // Fused multiply-add
+    /////////////////////////////////////////////////////////////////////////////////////
+
+    template <typename T, int N>
+    inline __internal__::RegisterPack<T, N> fma(
+        const __internal__::RegisterPack<T, N>& a,
+        const __internal__::RegisterPack<T, N>& b,
+        const __internal__::RegisterPack<T, N>& c)
+    {
+        return a.fmadd(b, c);
+    }
+
+    template <typename T, int N>
+    inline __internal__::RegisterPack<T, N> fma(
+        const __internal__::RegisterPack<T, N>& a,
+        const __internal__::RegisterPack<T, N>& b,
+        typename __internal_fma::scalar<T>::type c)
+    {
+        return a.fmadd(b, __internal__::RegisterPack<T, N>(c));
+    }
+
+    template <typename T, int N>
+    inline __internal__::RegisterPack<T, N> fma(
+        const __internal__::RegisterPack<T, N>& a,
+        typename __internal_fma::scalar<T>::type b,
+        const __internal__::RegisterPack<T, N>& c)
+    {
+        return a.fmadd(__internal__::RegisterPack<T, N>(b), c);
+    }
+
+    template <typename T, int N>
+    inline __internal__::RegisterPack<T, N> fma(
+        const __internal__::RegisterPack<T, N>& a,
+        typename __internal_fma::scalar<T>::type b,
+        typename __internal_fma::scalar<T>::type c)
+    {
+        return a.fmadd(__internal__::RegisterPack<T, N>(b), __internal__::RegisterPack<T, N>(c));
+    }
+
+    template <typename T, int N>
+    inline __internal__::RegisterPack<T, N> fma(
+        typename __internal_fma::scalar<T>::type a,
+        const __internal__::RegisterPack<T, N>& b,
+        const __internal__::RegisterPack<T, N>& c)
+    {
+        return b.fmadd(__internal__::RegisterPack<T, N>(a), c);
+    }
+
+    template <typename T, int N>
+    inline __internal__::RegisterPack<T, N> fma(
+        typename __internal_fma::scalar<T>::type a,
+        const __internal__::RegisterPack<T, N>& b,
+        typename __internal_fma::scalar<T>::type c)
+    {
+        return b.fmadd(__internal__::RegisterPack<T, N>(a), __internal__::RegisterPack<T, N>(c));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////
+    // Horizontal reductions
+    /////////////////////////////////////////////////////////////////////////////////////
+
+    template <typename T>
+    inline T hsum(const __internal__::FullWidthRegister<T>& x)
+    {
+        return x.hsum();
+    }
+
+    template <typename T, int N>
+    inline T hsum(const __internal__::RegisterPack<T, N>& x)
+    {
+        return x.hsum();
+    }
+
+    template <typename T>
+    inline T hprod(const __internal__::FullWidthRegister<T>& x)
+    {
+        return x.hprod();
+    }
+
+    template <typename T, int N>
+    inline T hprod(const __internal__::RegisterPack<T, N>& x)
+    {
+        return x.hprod();
+    }
+
+    template <typename T>
+    inline T hmin(const __internal__::FullWidthRegister<T>& x)
+    {
+        return x.hmin();
+    }
+
+    template <typename T, int N>
+    inline T hmin(const __internal__::RegisterPack<T, N>& x)
+    {
+        return x.hmin();
+    }
+
+    template <typename T>
+    inline T hmax(const __internal__::FullWidthRegister<T>& x)
+    {
+        return x.hmax();
+    }
+
+    template <typename T, int N>
+    inline T hmax(const __internal__::RegisterPack<T, N>& x)
+    {
+        return x.hmax();
+    }
+
+    template <typename T>
+    inline T hand(const __internal__::FullWidthRegister<T>& x)
+    {
+        return x.hand();
+    }
+
+    template <typename T, int N>
+    inline T hand(const __internal__::RegisterPack<T, N>& x)
+    {
+        return x.hand();
+    }
+
+    template <typename T>
+    inline T hor(const __internal__::FullWidthRegister<T>& x)
+    {
+        return x.hor();
+    }
+
+    template <typename T, int N>
+    inline T hor(const __internal__::RegisterPack<T, N>& x)
+    {
+        return x.hor();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////
+    // Saturating arithmetic
+    /////////////////////////////////////////////////////////////////////////////////////
+
+    template <typename T>
+    inline __internal__::FullWidthRegister<T> adds(
+        const __internal__::FullWidthRegister<T>& a,
+        const __internal__::FullWidthRegister<T>& b)
+    {
+        return a.adds(b);
+    }
+
+    template <typename T>
+    inline __internal__::FullWidthRegister<T> adds(
+        const __internal__::FullWidthRegister<T>& a,
+        typename __internal_saturating::scalar<T>::type b)
+    {
+        return a.adds(__internal__::FullWidthRegister<T>(b));
+    }
+
+    template <typename T>
+    inline __internal__::FullWidthRegister<T> adds(
+        typename __internal_saturating::scalar<T>::type a,
+        const __internal__::FullWidthRegister<T>& b)
+    {
+        return __internal__::FullWidthRegister<T>(a).adds(b);
+    }
+
+    template <typename T>
+    inline __internal__::FullWidthRegister<T> subs(
+        const __internal__::FullWidthRegister<T>& a,
+        const __internal__::FullWidthRegister<T>& b)
+    {
+        return a.subs(b);
+    }
+
+    template <typename T>
+    inline __internal__::FullWidthRegister<T> subs(
+        const __internal__::FullWidthRegister<T>& a,
+        typename __internal_saturating::scalar<T>::type b)
+    {
+        return a.subs(__internal__::FullWidthRegister<T>(b));
+    }
+
+    template <typename T>
+    inline __internal__::FullWidthRegister<T> subs(
+        typename __internal_saturating::scalar<T>::type a,
+        const __internal__::FullWidthRegister<T>& b)
+    {
+        return __internal__::FullWidthRegister<T>(a).subs(b);
+    }
+
+    template <typename T>
+    inline __internal__::FullWidthRegister<T> avg(
+        const __internal__::FullWidthRegister<T>& a,
+        const __internal__::FullWidthRegister<T>& b)
+    {
+        return a.avg(b);
+    }
+
+    template <typename T>
+    inline __internal__::FullWidthRegister<T> avg(
+        const __internal__::FullWidthRegister<T>& a,
+        typename __internal_saturating::scalar<T>::type b)
+    {
+        return a.avg(__internal__::FullWidthRegister<T>(b));
+    }
+
+    template <typename T>
+    inline __internal__::FullWidthRegister<T> avg(
+        typename __internal_saturating::scalar<T>::type a,
+        const __internal__::FullWidthRegister<T>& b)
+    {
+        return __internal__::FullWidthRegister<T>(a).avg(b);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////
+    // Math functions
+    /////////////////////////////////////////////////////////////////////////////////////
+
+    template <typename Accuracy = symd::standard, typename T, int N>
+    inline __internal__::RegisterPack<T, N> exp(const __internal__::RegisterPack<T, N>& x)
+    {
+        return x.template apply<T>([](const auto& part) { return exp<Accuracy>(part); });
+    }
+
+    template <typename Accuracy = symd::standard, typename T, int N>
+    inline __internal__::RegisterPack<T, N> log(const __internal__::RegisterPack<T, N>& x)
+    {
+        return x.template apply<T>([](const auto& part) { return log<Accuracy>(part); });
+    }
+
+    template <typename T, int N>
+    inline __internal__::RegisterPack<T, N> sin(const __internal__::RegisterPack<T, N>& x)
+    {
+        return x.template apply<T>([](const auto& part) { return sin(part); });
+    }
+
+    template <typename T, int N>
+    inline __internal__::RegisterPack<T, N> cos(const __internal__::RegisterPack<T, N>& x)
+    {
+        return x.template apply<T>([](const auto& part) { return cos(part); });
+    }
+
+    template <typename T, int N>
+    inline __internal__::RegisterPack<T, N> sigmoid(const __internal__::RegisterPack<T, N>& x)
+    {
+        return x.template apply<T>([](const auto& part) { return sigmoid(part); });
+    }
+
+    template <typename T, int N>
+    inline __internal__::RegisterPack<T, N> tanh(const __internal__::RegisterPack<T, N>& x)
+    {
+        return x.template apply<T>([](const auto& part) { return tanh(part); });
+    }
+
+    template <typename T, int N>
+    inline __internal__::RegisterPack<T, N> erf(const __internal__::RegisterPack<T, N>& x)
+    {
+        return x.template apply<T>([](const auto& part) { return erf(part); });
+    }
+
+    template <typename T, int N>
+    inline __internal__::RegisterPack<T, N> softplus(const __internal__::RegisterPack<T, N>& x)
+    {
+        return x.template apply<T>([](const auto& part) { return softplus(part); });
+    }
+
+    template <typename T, int N>
+    inline __internal__::RegisterPack<T, N> gelu(const __internal__::RegisterPack<T, N>& x)
+    {
+        return x.template apply<T>([](const auto& part) { return gelu(part); });
+    }
+
+    template <typename T, int N>
+    inline __internal__::RegisterPack<T, N> gelu_tanh(const __internal__::RegisterPack<T, N>& x)
+    {
+        return x.template apply<T>([](const auto& part) { return gelu_tanh(part); });
+    }
+
+    template <typename T, int N>
+    inline std::array<__internal__::RegisterPack<T, N>, 2> sincos(const __internal__::RegisterPack<T, N>& x)
+    {
+        std::array<__internal__::RegisterPack<T, N>, 2> res;
+
+        for (int i = 0; i < N; i++)
+        {
+            auto sc = sincos(x._parts[i]);
+            res[0]._parts[i] = sc[0];
+            res[1]._parts[i] = sc[1];
+        }
+
+        return res;
+    }
+    } // SYMD_ISA_NAMESPACE
+} // kernel
@@ -0,0 +1,91 @@
+#pragma once
+#include "../internal/symd_register.h"
+
+
+namespace symd::kernel
+{
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
+    // Horizontal reductions combine all elements of a register in one value. Kernels receive scalars on
+    // row tails, so scalar overloads return the input unchanged.
+
+    template <typename T>
+    inline T hsum(const __internal__::SymdRegister<T>& x)
+    {
+        return x.hsum();
+    }
+
+    template <typename T>
+    inline T hsum(T x)
+    {
+        static_assert(__internal__::UnderlyingRegister<T>::is_supported_type(), "Unsupported type.");
+        return x;
+    }
+
+    template <typename T>
+    inline T hprod(const __internal__::SymdRegister<T>& x)
+    {
+        return x.hprod();
+    }
+
+    template <typename T>
+    inline T hprod(T x)
+    {
+        static_assert(__internal__::UnderlyingRegister<T>::is_supported_type(), "Unsupported type.");
+        return x;
+    }
+
+    template <typename T>
+    inline T hmin(const __internal__::SymdRegister<T>& x)
+    {
+        return x.hmin();
+    }
+
+    template <typename T>
+    inline T hmin(T x)
+    {
+        static_assert(__internal__::UnderlyingRegister<T>::is_supported_type(), "Unsupported type.");
+        return x;
+    }
+
+    template <typename T>
+    inline T hmax(const __internal__::SymdRegister<T>& x)
+    {
+        return x.hmax();
+    }
+
+    template <typename T>
+    inline T hmax(T x)
+    {
+        static_assert(__internal__::UnderlyingRegister<T>::is_supported_type(), "Unsupported type.");
+        return x;
+    }
+
+    template <typename T>
+    inline T hand(const __internal__::SymdRegister<T>& x)
+    {
+        return x.hand();
+    }
+
+    template <typename T>
+    inline T hand(T x)
+    {
+        static_assert(std::is_integral_v<T>, "Bitwise horizontal reductions are supported for integer types only.");
+        return x;
+    }
+
+    template <typename T>
+    inline T hor(const __internal__::SymdRegister<T>& x)
+    {
+        return x.hor();
+    }
+
+    template <typename T>
+    inline T hor(T x)
+    {
+        static_assert(std::is_integral_v<T>, "Bitwise horizontal reductions are supported for integer types only.");
+        return x;
+    }
+    } // SYMD_ISA_NAMESPACE
+} // kernel
@@ -1,15 +1,65 @@
 #pragma once
 #include "../internal/symd_register.h"
+#include "../accuracy.h"
+#include "fma.h"
+#include "exp.h"
 
 
 namespace symd::kernel
 {
-    
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
+    namespace __internal_log
+    {
+        // log(x) = n * log(2) + log(a), a in [sqrt(0.5), sqrt(2)), log(a) = 2 * atanh((a - 1) / (a + 1))
+        template <typename T>
+        T log_precise(T x)
+        {
+            using C = __internal_exp::ExpConstants<float>;
+
+            // Multiply up subnormals by 2^24 to go into normal range
+            auto y = blend(x < 1e-37f, x * 16777216.0f, x);
+
+            auto n = convert_to<float>(fp_exp(y));
+            auto a = y / exp_part_of_float(y);
+            n = blend(x < 1e-37f, n - 24.0f, n);
+
+            // Center a around 1, so log(a) keeps relative precision on both sides of 1
+            auto big = a > 1.41421356f;
+            a = blend(big, a * 0.5f, a);
+            n = blend(big, n + 1.0f, n);
+
+            // |s| <= 0.172, series up to s^11 is below float precision
+            auto s = (a - 1.0f) / (a + 1.0f);
+            auto z = s * s;
+
+            auto r = fma(z, 2.0f / 11.0f, 2.0f / 9.0f);
+            r = fma(r, z, 2.0f / 7.0f);
+            r = fma(r, z, 2.0f / 5.0f);
+            r = fma(r, z, 2.0f / 3.0f);
+
+            auto log_a = fma(r * z, s, s + s);
+
+            return fma(n, C::ln2_hi, fma(n, C::ln2_lo, log_a));
+        }
+    }
+
     /// Computes the natural (base e) logarithm of x.
     /// Fast implementation is done by moving input to 1-2 range and then approximating logarithm with polynomial.
-    template <typename T> 
+    /// Accuracy tiers (float):
+    ///     symd::fast      - 3rd order polynomial, absolute error below 2e-3.
+    ///     symd::standard  - 4th order polynomial, absolute error below 1e-4. Default.
+    ///     symd::precise   - Input centered around 1 and atanh series, error below 2 ULP.
+    template <typename Accuracy = symd::standard, typename T>
     T log(T x)
     {
+        static_assert(std::is_same_v<Accuracy, symd::fast> || std::is_same_v<Accuracy, symd::standard> ||
+            std::is_same_v<Accuracy, symd::precise>, "Unknown accuracy tier.");
+
+        if constexpr (std::is_same_v<Accuracy, symd::precise>)
+            return __internal_log::log_precise(x);
+
         /// Implemetation algorithm
         // Move input to 1-2 range and approximate with polynomial using remez algorithm
         // log(x) = log(a*2^n) = log(a) + n*log(2)
@@ -28,13 +78,26 @@ namespace symd::kernel
         // For subnormals add bias since we multiplied them up
         n = blend(x < 1e-37, n-18.420680744f, n);
 
-        // Third order poly
-        // auto log_a = a * (a * (a * 0.10969f - 0.729104f) + 2.11263f) - 1.49278f;
+        decltype(a) log_a;
 
-        // 4th order poly
-        auto log_a = a * (a * (a * (a * (-0.056570851f) + 0.44717955f) - 1.4699568f) + 2.8212026f) - 1.7417939f;
+        if constexpr (std::is_same_v<Accuracy, symd::fast>)
+        {
+            // Third order poly
+            log_a = fma(a, 0.10969f, -0.729104f);
+            log_a = fma(log_a, a, 2.11263f);
+            log_a = fma(log_a, a, -1.49278f);
+        }
+        else
+        {
+            // 4th order poly
+            log_a = fma(a, -0.056570851f, 0.44717955f);
+            log_a = fma(log_a, a, -1.4699568f);
+            log_a = fma(log_a, a, 2.8212026f);
+            log_a = fma(log_a, a, -1.7417939f);
+        }
 
         auto result = log_a + n;
         return blend(x == 1.0f, 0.0f, result);
     }
-}
+    } // SYMD_ISA_NAMESPACE
+}
\ No newline at end of file
@@ -0,0 +1,122 @@
+#pragma once
+#include "../internal/symd_register.h"
+#include <algorithm>
+#include <limits>
+
+
+namespace symd::kernel
+{
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
+    // Saturating arithmetic for unsigned char and 16 bit integers. Results are clamped to range of T, so 8 bit pixel
+    // pipelines (blending, brightness adjustment) can stay in 8 bit lanes instead of widening to int and back.
+
+    namespace __internal_saturating
+    {
+        template <typename T>
+        constexpr void assert_saturating_type()
+        {
+            static_assert(std::is_same_v<T, unsigned char> || __internal__::is_16bit_int<T>,
+                "Saturating arithmetic is supported for unsigned char, int16_t and uint16_t.");
+        }
+
+        template <typename T>
+        inline T saturate(int x)
+        {
+            return (T)std::clamp(x, (int)std::numeric_limits<T>::min(), (int)std::numeric_limits<T>::max());
+        }
+
+        // Keeps scalar arguments out of template deduction, so int constants can be used with 8 and 16 bit registers.
+        template <typename T>
+        struct scalar
+        {
+            using type = T;
+        };
+    }
+
+    /// <summary>
+    /// Adds a and b with saturation.
+    /// </summary>
+    template <typename T>
+    inline T adds(T a, T b)
+    {
+        __internal_saturating::assert_saturating_type<T>();
+        return __internal_saturating::saturate<T>((int)a + (int)b);
+    }
+
+    template <typename T>
+    inline __internal__::SymdRegister<T> adds(const __internal__::SymdRegister<T>& a, const __internal__::SymdRegister<T>& b)
+    {
+        return a.adds(b);
+    }
+
+    template <typename T>
+    inline __internal__::SymdRegister<T> adds(const __internal__::SymdRegister<T>& a, typename __internal_saturating::scalar<T>::type b)
+    {
+        return a.adds(__internal__::SymdRegister<T>(b));
+    }
+
+    template <typename T>
+    inline __internal__::SymdRegister<T> adds(typename __internal_saturating::scalar<T>::type a, const __internal__::SymdRegister<T>& b)
+    {
+        return __internal__::SymdRegister<T>(a).adds(b);
+    }
+
+    /// <summary>
+    /// Subtracts b from a with saturation.
+    /// </summary>
+    template <typename T>
+    inline T subs(T a, T b)
+    {
+        __internal_saturating::assert_saturating_type<T>();
+        return __internal_saturating::saturate<T>((int)a - (int)b);
+    }
+
+    template <typename T>
+    inline __internal__::SymdRegister<T> subs(const __internal__::SymdRegister<T>& a, const __internal__::SymdRegister<T>& b)
+    {
+        return a.subs(b);
+    }
+
+    template <typename T>
+    inline __internal__::SymdRegister<T> subs(const __internal__::SymdRegister<T>& a, typename __internal_saturating::scalar<T>::type b)
+    {
+        return a.subs(__internal__::SymdRegister<T>(b));
+    }
+
+    template <typename T>
+    inline __internal__::SymdRegister<T> subs(typename __internal_saturating::scalar<T>::type a, const __internal__::SymdRegister<T>& b)
+    {
+        return __internal__::SymdRegister<T>(a).subs(b);
+    }
+
+    /// <summary>
+    /// Rounding average (a + b + 1) >> 1. Never overflows.
+    /// </summary>
+    template <typename T>
+    inline T avg(T a, T b)
+    {
+        __internal_saturating::assert_saturating_type<T>();
+        return (T)(((int)a + (int)b + 1) >> 1);
+    }
+
+    template <typename T>
+    inline __internal__::SymdRegister<T> avg(const __internal__::SymdRegister<T>& a, const __internal__::SymdRegister<T>& b)
+    {
+        return a.avg(b);
+    }
+
+    template <typename T>
+    inline __internal__::SymdRegister<T> avg(const __internal__::SymdRegister<T>& a, typename __internal_saturating::scalar<T>::type b)
+    {
+        return a.avg(__internal__::SymdRegister<T>(b));
+    }
+
+    template <typename T>
+    inline __internal__::SymdRegister<T> avg(typename __internal_saturating::scalar<T>::type a, const __internal__::SymdRegister<T>& b)
+    {
+        return __internal__::SymdRegister<T>(a).avg(b);
+    }
+    } // SYMD_ISA_NAMESPACE
+} // kernel
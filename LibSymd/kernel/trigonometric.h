@@ -0,0 +1,149 @@
+#pragma once
+#include "../internal/symd_register.h"
+#include "convert_to.h"
+#include "blend.h"
+#include "fma.h"
+#include "exp.h"
+#include <array>
+#include <cmath>
+
+
+namespace symd::kernel
+{
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
+    namespace __internal_trig
+    {
+        // Cody-Waite split of pi/2 and minimax polynomials for sin and cos on [-pi/4, pi/4] (Cephes).
+        template <typename DType>
+        struct TrigConstants;
+
+        template <>
+        struct TrigConstants<float>
+        {
+            static constexpr float two_over_pi = 0.63661977236758134308f;
+            static constexpr float pi_over_2[3] = { 1.5703125f, 4.837512969970703125e-4f, 7.54978995489188216e-8f };
+
+            static constexpr std::array<float, 3> sin_coeffs = { -1.9515295891e-4f, 8.3321608736e-3f, -1.6666654611e-1f };
+            static constexpr std::array<float, 3> cos_coeffs = { 2.443315711809948e-5f, -1.388731625493765e-3f, 4.166664568298827e-2f };
+        };
+
+        template <>
+        struct TrigConstants<double>
+        {
+            static constexpr double two_over_pi = 0.63661977236758134308;
+            static constexpr double pi_over_2[3] = { 1.57079625129699707031, 7.54978941586159635336e-8, 5.39030285815811905290e-15 };
+
+            static constexpr std::array<double, 6> sin_coeffs = {
+                1.58962301576546568060e-10, -2.50507477628578072866e-8, 2.75573136213857245213e-6,
+                -1.98412698295895385996e-4, 8.33333333332211858878e-3, -1.66666666666666307295e-1 };
+
+            static constexpr std::array<double, 6> cos_coeffs = {
+                -1.13585365213876817300e-11, 2.08757008419747316778e-9, -2.75573141792967388112e-7,
+                2.48015872888517045348e-5, -1.38888888888730564116e-3, 4.16666666666665929218e-2 };
+        };
+
+        using __internal_exp::round_nearest;
+
+        template <typename DType, typename T, size_t N>
+        T polynomial(const T& z, const std::array<DType, N>& coeffs)
+        {
+            T p = fma(z, coeffs[0], coeffs[1]);
+
+            for (size_t i = 2; i < N; i++)
+                p = fma(p, z, coeffs[i]);
+
+            return p;
+        }
+
+        // Computes sin and cos of x at once. Works for scalars and registers of DType.
+        template <typename DType, typename T>
+        std::array<T, 2> sincos_impl(const T& x)
+        {
+            using C = TrigConstants<DType>;
+
+            // x = q * pi/2 + r, r in [-pi/4, pi/4]
+            T q = round_nearest<DType>(x * C::two_over_pi);
+            T r = fma(q, -C::pi_over_2[0], x);
+            r = fma(q, -C::pi_over_2[1], r);
+            r = fma(q, -C::pi_over_2[2], r);
+
+            T z = r * r;
+            T sinR = fma(polynomial(z, C::sin_coeffs) * z, r, r);
+            T cosR = fma(polynomial(z, C::cos_coeffs) * z, z, fma(z, (DType)-0.5, (DType)1.0));
+
+            // Quadrant m = q mod 4, in {-2, -1, 0, 1, 2}
+            T m = q - round_nearest<DType>(q * (DType)0.25) * (DType)4.0;
+            T absM = std::abs(m);
+
+            // Odd quadrants swap sin and cos
+            auto odd = absM == (DType)1.0;
+            T sinRes = blend(odd, cosR, sinR);
+            T cosRes = blend(odd, sinR, cosR);
+
+            // sin is negative in quadrants 2 and 3 (-1), cos in quadrants 1 and 2
+            auto half = absM == (DType)2.0;
+            sinRes = blend(half | (m == (DType)-1.0), -sinRes, sinRes);
+            cosRes = blend(half | (m == (DType)1.0), -cosRes, cosRes);
+
+            return { sinRes, cosRes };
+        }
+
+        template <typename T>
+        std::array<T, 2> sincos(const T& x)
+        {
+            if constexpr (std::is_same_v<T, symd::bfloat16>)
+            {
+                auto res = sincos_impl<float>((float)x);
+                return { symd::bfloat16(res[0]), symd::bfloat16(res[1]) };
+            }
+            else
+            {
+                return sincos_impl<T>(x);
+            }
+        }
+
+        template <typename T>
+        std::array<__internal__::SymdRegister<T>, 2> sincos(const __internal__::SymdRegister<T>& x)
+        {
+            if constexpr (std::is_same_v<T, symd::bfloat16>)
+            {
+                // Constants would lose precision in bfloat16, so compute in float
+                auto res = sincos_impl<float>(convert_to<float>(x));
+                return { convert_to<symd::bfloat16>(res[0]), convert_to<symd::bfloat16>(res[1]) };
+            }
+            else
+            {
+                return sincos_impl<T>(x);
+            }
+        }
+    }
+
+
+    /// Computes sine and cosine of x (in radians) at once, returned as { sin(x), cos(x) }.
+    /// Argument is reduced to [-pi/4, pi/4] and both functions are approximated with minimax polynomials.
+    /// Error is few ULP for |x| < 8192 (float, bfloat16) or |x| < 1e8 (double), accuracy drops for larger arguments.
+    template <typename T>
+    std::array<T, 2> sincos(T x)
+    {
+        return __internal_trig::sincos(x);
+    }
+
+
+    /// Computes sine of x (in radians). See sincos for accuracy.
+    template <typename T>
+    T sin(T x)
+    {
+        return __internal_trig::sincos(x)[0];
+    }
+
+
+    /// Computes cosine of x (in radians). See sincos for accuracy.
+    template <typename T>
+    T cos(T x)
+    {
+        return __internal_trig::sincos(x)[1];
+    }
+    } // SYMD_ISA_NAMESPACE
+}
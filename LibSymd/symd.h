@@ -1,4 +1,6 @@
 #pragma once
+#include <tuple>
+#include <stdexcept>
 #include <future>
 #include <algorithm>
 #include <functional>
@@ -8,31 +10,96 @@
 #include "kernel/all_ops.h"
 #include "internal/sub_view.h"
 #include "internal/stencil_view.h"
+#include "internal/broadcast_view.h"
+#include "internal/tensor_pool.h"
+#include "internal/streaming_view.h"
+#include "internal/full_width_view.h"
 #include "internal/multi_output.h"
 
+#include "execution_policy.h"
+#include "cpu_dispatch.h"
+#include "internal/thread_pool.h"
+#include "internal/cache_info.h"
+
 #ifdef SYMD_USE_TBB
     #include "tbb/parallel_for_each.h"
-#elif defined(_WIN32) || defined(WIN32)
+    #include "tbb/task_arena.h"
+#endif
+
+#if defined(_WIN32) || defined(WIN32) || defined(SYMD_USE_STD_EXECUTION)
     #include <execution>
+    #define SYMD_HAS_STD_EXECUTION 1
 #endif
 
 
 namespace symd::__internal__
-{ 
+{
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
     template <typename Func, typename FirstInput, typename... Inputs>
     auto applyToFirstInput(Func&& func, const FirstInput& firstInput, const Inputs&... inputs)
     {
         return func(firstInput);
     }
 
+    /// <summary>
+    /// Largest border (stencil size) of all inputs in each dimension.
+    /// </summary>
     template <typename FirstInput, typename... Inputs>
-    Region vectorRegion(const FirstInput& firstInput, const Inputs&... inputs)
+    Dimensions maxBorder(const FirstInput& firstInput, const Inputs&... inputs)
     {
-        std::vector<Dimensions> borders{ getBorder(inputs)... };
         auto maxBorders = getBorder(firstInput);
+        ((maxBorders = maxBorders.eltwise_max(getBorder(inputs))), ...);
+
+        return maxBorders;
+    }
+
+    /// <summary>
+    /// List of regions borrowed from free list of calling thread and given back on destruction. Lists keep their
+    /// capacity, so repeated maps do not allocate. Nested maps (from kernels or other threads) borrow their own.
+    /// </summary>
+    class RegionScratch
+    {
+        std::vector<Region> _regions;
+
+        static std::vector<std::vector<Region>>& freeLists()
+        {
+            thread_local std::vector<std::vector<Region>> lists;
+            return lists;
+        }
+
+    public:
+        RegionScratch()
+        {
+            auto& lists = freeLists();
+
+            if (!lists.empty())
+            {
+                _regions = std::move(lists.back());
+                lists.pop_back();
+                _regions.clear();
+            }
+        }
+
+        RegionScratch(const RegionScratch&) = delete;
+        RegionScratch& operator=(const RegionScratch&) = delete;
+
+        ~RegionScratch()
+        {
+            freeLists().push_back(std::move(_regions));
+        }
 
-        for (const auto& border : borders)
-            maxBorders = maxBorders.eltwise_max(border);
+        std::vector<Region>& regions()
+        {
+            return _regions;
+        }
+    };
+
+    template <typename FirstInput, typename... Inputs>
+    Region vectorRegion(const FirstInput& firstInput, const Inputs&... inputs)
+    {
+        auto maxBorders = maxBorder(firstInput, inputs...);
 
         auto shape = getShape(firstInput);
         auto startShape = shape.zeros_like() + maxBorders;
@@ -42,6 +109,219 @@ namespace symd::__internal__
         return region.align_with_symd_len(SYMD_LEN);
     }
 
+    template <int64_t... Is, typename Compute, typename Save>
+    int64_t map_unrolled_impl(std::integer_sequence<int64_t, Is...>, int64_t i, int64_t end, int64_t len, Compute& compute, Save& save)
+    {
+        constexpr int64_t unroll = sizeof...(Is);
+
+        for (; (i + unroll * len) <= end; i += unroll * len)
+        {
+            // All vectors are computed before any is saved, so their dependency chains are independent.
+            auto results = std::make_tuple(compute(i + Is * len)...);
+            (save(i + Is * len, std::get<Is>(results)), ...);
+        }
+
+        return i;
+    }
+
+    /// <summary>
+    /// Processes Unroll vectors of len elements per iteration while whole group fits before end. Returns index of
+    /// first unprocessed element, remaining vectors are left to caller.
+    /// </summary>
+    template <int Unroll, typename Compute, typename Save>
+    int64_t map_unrolled(int64_t i, int64_t end, int64_t len, Compute&& compute, Save&& save)
+    {
+        if constexpr (Unroll <= 1)
+            return i;
+        else
+            return map_unrolled_impl(std::make_integer_sequence<int64_t, Unroll>(), i, end, len, compute, save);
+    }
+
+    // Saves all elements of the row, cursors are finished by map_row.
+    template <int Unroll, typename OutCursor, typename Operation, typename... InCursors>
+    void map_row_impl(
+        OutCursor& outCursor,
+        Operation&& operation,
+        int64_t width,
+        int64_t vecStart,
+        int64_t vecEnd,
+        bool inside_vec_region,
+        int64_t prefetchDistance,
+        InCursors&... inCursors)
+    {
+        int64_t i = 0;
+
+        auto prefetchInputs = [&](int64_t ind)
+        {
+            if (prefetchDistance > 0)
+                (inCursors.prefetch(ind, prefetchDistance), ...);
+        };
+
+        // Outputs opted in with views::full_width over unsigned char memory have no borders, whole row goes in full
+        // width registers and one partial register.
+        if constexpr (isFullWidthMap<OutCursor, InCursors...>)
+        {
+            constexpr int len = symd_len<unsigned char>;
+
+            i = map_unrolled<Unroll>(i, width, len,
+                [&](int64_t ind) { prefetchInputs(ind); return operation(inCursors.fetchFull(ind)...); },
+                [&](int64_t ind, const auto& res) { outCursor.saveVec(ind, res); });
+
+            for (; (i + len) <= width; i += len)
+            {
+                prefetchInputs(i);
+                outCursor.saveVec(i, operation(inCursors.fetchFull(i)...));
+            }
+
+            if (i < width)
+            {
+                int count = (int)(width - i);
+                outCursor.saveVecPartial(i, operation(inCursors.fetchFullPartial(i, count)...), count);
+            }
+
+            return;
+        }
+
+        // Rows of tensors and pooled buffers start at 64 byte boundary, whole row uses aligned loads and stores.
+        if constexpr (isAlignedMap<OutCursor, InCursors...>)
+        {
+            if (outCursor.isAligned() && (inCursors.isAligned() && ...))
+            {
+                i = map_unrolled<Unroll>(i, width, __internal__::SYMD_LEN,
+                    [&](int64_t ind) { prefetchInputs(ind); return operation(inCursors.fetchVecAligned(ind)...); },
+                    [&](int64_t ind, const auto& res) { outCursor.saveVecAligned(ind, res); });
+
+                for (; (i + __internal__::SYMD_LEN) <= width; i += __internal__::SYMD_LEN)
+                {
+                    prefetchInputs(i);
+                    outCursor.saveVecAligned(i, operation(inCursors.fetchVecAligned(i)...));
+                }
+
+                if (i < width)
+                {
+                    int count = (int)(width - i);
+                    outCursor.saveVecPartial(i, operation(inCursors.fetchVecPartial(i, count)...), count);
+                }
+
+                return;
+            }
+        }
+
+        // Stencils over memory handle borders in vector code too. Vectors near border take slower
+        // border path, vectors inside of vector region plain loads, only the tail may remain scalar.
+        if constexpr ((InCursors::handles_borders && ...))
+        {
+            int64_t interiorStart = inside_vec_region ? vecStart : width;
+            int64_t interiorEnd = inside_vec_region ? vecEnd : -1;
+
+            for (; i < interiorStart && (i + __internal__::SYMD_LEN) <= width; i += __internal__::SYMD_LEN)
+            {
+                prefetchInputs(i);
+                outCursor.saveVec(i, operation(inCursors.fetchVecBorder(i)...));
+            }
+
+            i = map_unrolled<Unroll>(i, interiorEnd + 1, __internal__::SYMD_LEN,
+                [&](int64_t ind) { prefetchInputs(ind); return operation(inCursors.fetchVec(ind)...); },
+                [&](int64_t ind, const auto& res) { outCursor.saveVec(ind, res); });
+
+            for (; (i + __internal__::SYMD_LEN - 1) <= interiorEnd; i += __internal__::SYMD_LEN)
+            {
+                prefetchInputs(i);
+                outCursor.saveVec(i, operation(inCursors.fetchVec(i)...));
+            }
+
+            for (; (i + __internal__::SYMD_LEN) <= width; i += __internal__::SYMD_LEN)
+            {
+                prefetchInputs(i);
+                outCursor.saveVec(i, operation(inCursors.fetchVecBorder(i)...));
+            }
+
+            if constexpr (OutCursor::supports_partial)
+            {
+                if (i < width)
+                {
+                    int count = (int)(width - i);
+                    outCursor.saveVecPartial(i, operation(inCursors.fetchVecBorderPartial(i, count)...), count);
+                    return;
+                }
+            }
+
+            for (; i < width; ++i)
+                outCursor.save(i, operation(inCursors.fetch(i)...));
+
+            return;
+        }
+
+        for (; i < vecStart; ++i)
+            outCursor.save(i, operation(inCursors.fetch(i)...));
+
+        if (inside_vec_region)
+        {
+            i = map_unrolled<Unroll>(i, vecEnd + 1, __internal__::SYMD_LEN,
+                [&](int64_t ind) { prefetchInputs(ind); return operation(inCursors.fetchVec(ind)...); },
+                [&](int64_t ind, const auto& res) { outCursor.saveVec(ind, res); });
+
+            for (; (i + __internal__::SYMD_LEN - 1) <= vecEnd; i += __internal__::SYMD_LEN)
+            {
+                prefetchInputs(i);
+                outCursor.saveVec(i, operation(inCursors.fetchVec(i)...));
+            }
+
+            // Finish row with one partial vector if all views support masked loads and stores.
+            if constexpr (OutCursor::supports_partial && (InCursors::supports_partial && ...))
+            {
+                if (i < width)
+                {
+                    int count = (int)(width - i);
+                    outCursor.saveVecPartial(i, operation(inCursors.fetchVecPartial(i, count)...), count);
+                    return;
+                }
+            }
+        }
+
+        for (; i < width; ++i)
+            outCursor.save(i, operation(inCursors.fetch(i)...));
+    }
+
+    /// <summary>
+    /// Maps one row (last dimension). Views are accessed through row cursors so there is no index math in inner loops.
+    /// </summary>
+    template <typename OutCursor, typename Operation, typename... InCursors>
+    void map_row(
+        OutCursor outCursor,
+        Operation&& operation,
+        int64_t width,
+        int64_t vecStart,
+        int64_t vecEnd,
+        bool inside_vec_region,
+        int64_t prefetchDistance,
+        int unroll,
+        InCursors... inCursors)
+    {
+        auto mapRow = [&](auto unrollConstant)
+        {
+            map_row_impl<decltype(unrollConstant)::value>(
+                outCursor,
+                std::forward<Operation>(operation),
+                width,
+                vecStart,
+                vecEnd,
+                inside_vec_region,
+                prefetchDistance,
+                inCursors...);
+        };
+
+        // Validated by map (execution_policy::check_unroll)
+        if (unroll == 4)
+            mapRow(std::integral_constant<int, 4>());
+        else if (unroll == 2)
+            mapRow(std::integral_constant<int, 2>());
+        else
+            mapRow(std::integral_constant<int, 1>());
+
+        finishRow(outCursor);
+    }
+
     template <typename Output, typename Operation, typename... Inputs>
     void map_single_core_impl(
         Output& result, 
@@ -51,40 +331,29 @@ namespace symd::__internal__
         Dimensions proc_coord,
         int proc_dim,
         bool inside_vec_region,
+        int64_t prefetchDistance,
+        int unroll,
         Inputs&&... inputs)
     {
         // Last dim
         if (proc_dim == shape.num_dims() - 1)
         {
-            int64_t i = 0;
+            proc_coord.set_ith_dim(proc_dim, 0);
 
-            for (; i < vecRegion.startCoord[proc_dim]; ++i)
-            {
-                proc_coord.set_ith_dim(proc_dim, i);
-                auto pix = operation(__internal__::fetchData(inputs, proc_coord)...);
-                __internal__::saveData(result, pix, proc_coord);
-            }
-
-            if (inside_vec_region)
-            {
-                for (; (i + __internal__::SYMD_LEN - 1) <= vecRegion.endCoord[proc_dim]; i += __internal__::SYMD_LEN)
-                {
-                    proc_coord.set_ith_dim(proc_dim, i);
-                    auto vecRes = operation(__internal__::fetchVecData(inputs, proc_coord)...);
-                    __internal__::saveVecData(result, vecRes, proc_coord);
-                }
-            }
-
-            for (; i < shape[proc_dim]; ++i)
-            {
-                proc_coord.set_ith_dim(proc_dim, i);
-                auto pix = operation(__internal__::fetchData(inputs, proc_coord)...);
-                __internal__::saveData(result, pix, proc_coord);
-            }
+            map_row(
+                rowCursor(result, proc_coord),
+                std::forward<Operation>(operation),
+                shape[proc_dim],
+                vecRegion.startCoord[proc_dim],
+                vecRegion.endCoord[proc_dim],
+                inside_vec_region,
+                prefetchDistance,
+                unroll,
+                rowCursor(inputs, proc_coord)...);
         }
         else
         {
-            for (size_t i = 0; i < shape[proc_dim]; ++i)
+            for (int64_t i = 0; i < shape[proc_dim]; ++i)
             {
                 proc_coord.set_ith_dim(proc_dim, i);
 
@@ -100,24 +369,93 @@ namespace symd::__internal__
                     proc_coord,
                     proc_dim + 1,
                     is_inside_vec_region,
+                    prefetchDistance,
+                    unroll,
                     std::forward<Inputs>(inputs)... );
             }
         }
     }
+
+    /// <summary>
+    /// Backend which runs map with given policy. Throws std::invalid_argument when requested backend is not compiled
+    /// in or can not honour the policy (number of threads or pinning), so misconfiguration is not silently ignored.
+    /// </summary>
+    inline Backend resolveBackend(const execution_policy& policy)
+    {
+        auto backend = policy.backend;
+
+        // Only built-in thread pool pins threads and std::execution does not take number of threads.
+        if (backend == Backend::automatic)
+        {
+#ifdef SYMD_USE_TBB
+            backend = policy.pin_threads ? Backend::thread_pool : Backend::tbb;
+#elif defined(_WIN32) || defined(WIN32)
+            backend = (policy.pin_threads || policy.num_threads > 0) ? Backend::thread_pool : Backend::std_execution;
+#else
+            backend = Backend::thread_pool;
+#endif
+        }
+
+#ifndef SYMD_USE_TBB
+        if (backend == Backend::tbb)
+            throw std::invalid_argument("Backend::tbb requires SYMD_USE_TBB.");
+#endif
+
+#ifndef SYMD_HAS_STD_EXECUTION
+        if (backend == Backend::std_execution)
+            throw std::invalid_argument("Backend::std_execution requires Windows or SYMD_USE_STD_EXECUTION.");
+#endif
+
+        if (backend == Backend::std_execution && policy.num_threads > 0)
+            throw std::invalid_argument("Backend::std_execution can not limit number of threads.");
+
+        if (policy.pin_threads && (backend == Backend::tbb || backend == Backend::std_execution))
+            throw std::invalid_argument("Only Backend::thread_pool supports pinned threads.");
+
+        return backend;
+    }
+    } // SYMD_ISA_NAMESPACE
 } // symd::__internal__
 
 namespace symd
 {
+    inline namespace SYMD_ISA_NAMESPACE
+    {
+
     /// <summary>
     /// Maps inputs to result using operation. Performs operation on single thread/core.
     /// </summary>
+    /// <param name="policy">Only per-thread options are used (prefetch_distance, unroll), backend and threads are ignored.</param>
     /// <param name="result">Storing Result of the mapping operation.</param>
     /// <param name="operation">Operation to be performed on inputs.</param>
     /// <param name="...inputs">Input views for applying operation.</param>
     template <typename Output, typename Operation, typename... Inputs>
-    void map_single_core(Output& result, Operation&& operation, Inputs&&... inputs)
+    void map_single_core(const execution_policy& policy, Output& result, Operation&& operation, Inputs&&... inputs)
     {
+        execution_policy::check_unroll(policy.unroll);
+
         auto shape = __internal__::getShape(result);
+
+        // Densely packed views are traversed as one long row, so there is only one scalar tail.
+        if (shape.num_dims() > 1 && __internal__::isDense(result) && (__internal__::isDense(inputs) && ...))
+        {
+            auto flatRegion = __internal__::Region(Dimensions({ shape.num_elements() })).align_with_symd_len(__internal__::SYMD_LEN);
+            auto zeros = shape.zeros_like();
+
+            __internal__::map_row(
+                __internal__::rowCursor(result, zeros),
+                std::forward<Operation>(operation),
+                shape.num_elements(),
+                0,
+                flatRegion.endCoord[0],
+                true,
+                policy.prefetch_distance,
+                policy.unroll,
+                __internal__::rowCursor(inputs, zeros)...);
+
+            __internal__::finishMap(result);
+            return;
+        }
         auto vecRegion = __internal__::vectorRegion(inputs...);
 
         __internal__::map_single_core_impl(
@@ -128,37 +466,138 @@ namespace symd
             shape.zeros_like(),
             0,
             true,
+            policy.prefetch_distance,
+            policy.unroll,
             std::forward<Inputs>(inputs)... );
+
+        __internal__::finishMap(result);
     }
 
     /// <summary>
-    /// Maps inputs to result using operation. Performs operation on mumltiple threads/cores.
+    /// Maps inputs to result using operation. Performs operation on single thread/core.
+    /// </summary>
+    /// <param name="result">Storing Result of the mapping operation.</param>
+    /// <param name="operation">Operation to be performed on inputs.</param>
+    /// <param name="...inputs">Input views for applying operation.</param>
+    template <typename Output, typename Operation, typename... Inputs>
+    std::enable_if_t<!is_execution_policy_v<Output>> map_single_core(Output& result, Operation&& operation, Inputs&&... inputs)
+    {
+        map_single_core(execution_policy(), result, std::forward<Operation>(operation), std::forward<Inputs>(inputs)...);
+    }
+
+    /// <summary>
+    /// Maps inputs to result using operation. Splits work in regions and distributes them according to policy.
     /// </summary>
+    /// <param name="policy">Parallel execution configuration (backend, number of threads, min region size...).</param>
     /// <param name="result">Storing Result of the mapping operation.</param>
     /// <param name="operation">Operation to be performed on inputs.</param>
     /// <param name="...inputs">Input views for applying operation.</param>
     template <typename Result, typename Operation, typename... Inputs>
-    void map(Result& result, Operation&& operation, Inputs&&... inputs)
+    void map(const execution_policy& policy, Result& result, Operation&& operation, Inputs&&... inputs)
     {
+        auto backend = __internal__::resolveBackend(policy);
+        execution_policy::check_unroll(policy.unroll);
+        execution_policy::check_min_region_size(policy.min_region_size);
+
         auto shape = __internal__::getShape(result);
 
-        std::vector<__internal__::Region> regions;
-        __internal__::Region(shape).split(regions);
+        __internal__::RegionScratch regionScratch;
+        auto& regions = regionScratch.regions();
+
+        if (policy.backend != Backend::single_core)
+        {
+            // Outputs which accumulate along some axes can be split only along the others.
+            uint32_t splitMask = __internal__::splitMask(result);
+
+            __internal__::Region(shape).split(regions, policy.min_region_size, splitMask);
 
+            // Halves of a stencil map re-read rows shared with their neighbours and may not fit in cache.
+            // Cache sized tiles are used instead, unless plain split already gives smaller regions.
+            auto border = __internal__::maxBorder(inputs...);
+            bool hasBorder = false;
+
+            for (int i = 0; i < border.num_dims(); i++)
+                hasBorder = hasBorder || border[i] > 0;
+
+            if (policy.cache_blocking && hasBorder && splitMask == ~0u)
+            {
+                int64_t bytesPerElement = (__internal__::elementSize(result) + ... + __internal__::elementSize(inputs));
+
+                __internal__::RegionScratch tileScratch;
+                auto& tiles = tileScratch.regions();
+                __internal__::Region(shape).tile(tiles, border, bytesPerElement, __internal__::l1CacheSize(), __internal__::l2CacheSize());
+
+                // Swap keeps both buffers for next map
+                if (tiles.size() > regions.size())
+                    regions.swap(tiles);
+            }
+        }
+
+        if (regions.size() <= 1)
+        {
+            map_single_core(policy, result, operation, inputs...);
+            return;
+        }
+
+        // Reductions keep result of every region in its own slot, slots are combined after all regions are done.
+        __internal__::prepareRegionPartials(result, regions.size());
+
+        // All backends pass elements of regions, so region index follows from address.
+        auto mapRegion = [&](const __internal__::Region& region)
+        {
+            auto subRes = __internal__::sub_view(result, region);
+            map_single_core(policy, subRes, operation, __internal__::sub_view(inputs, region)...);
+
+            __internal__::storeRegionPartial(result, subRes, (size_t)(&region - regions.data()));
+        };
+
+        switch (backend)
+        {
 #ifdef SYMD_USE_TBB
-        tbb::parallel_for_each(regions.begin(), regions.end(), [&](__internal__::Region& region)
+        case Backend::tbb:
             {
-                auto subRes = __internal__::sub_view(result, region);
-                map_single_core(subRes, operation, __internal__::sub_view(std::forward<Inputs>(inputs), region)...);
-            });
-#elif defined(_WIN32) || defined(WIN32)
-        std::for_each(std::execution::par_unseq, regions.begin(), regions.end(), [&](__internal__::Region& region)
+                auto runRegions = [&]()
+                {
+                    tbb::parallel_for_each(regions.begin(), regions.end(), mapRegion);
+                };
+
+                if (policy.num_threads > 0)
+                    tbb::task_arena(policy.num_threads).execute(runRegions);
+                else
+                    runRegions();
+
+                __internal__::combineRegionPartials(result);
+                return;
+            }
+#endif
+#ifdef SYMD_HAS_STD_EXECUTION
+        case Backend::std_execution:
+            std::for_each(std::execution::par_unseq, regions.begin(), regions.end(), mapRegion);
+            __internal__::combineRegionPartials(result);
+            return;
+#endif
+        default:
+            break;
+        }
+
+        __internal__::ThreadPool::instance(policy.num_threads, policy.pin_threads).parallel_for(regions.size(), [&](size_t i)
             {
-                auto subRes = __internal__::sub_view(result, region);
-                map_single_core(subRes, operation, __internal__::sub_view(std::forward<Inputs>(inputs), region)...);
+                mapRegion(regions[i]);
             });
-#else
-        map_single_core(result, operation, inputs...);
-#endif
+
+        __internal__::combineRegionPartials(result);
+    }
+
+    /// <summary>
+    /// Maps inputs to result using operation. Performs operation on mumltiple threads/cores.
+    /// </summary>
+    /// <param name="result">Storing Result of the mapping operation.</param>
+    /// <param name="operation">Operation to be performed on inputs.</param>
+    /// <param name="...inputs">Input views for applying operation.</param>
+    template <typename Result, typename Operation, typename... Inputs>
+    std::enable_if_t<!is_execution_policy_v<Result>> map(Result& result, Operation&& operation, Inputs&&... inputs)
+    {
+        map(execution_policy(), result, std::forward<Operation>(operation), std::forward<Inputs>(inputs)...);
     }
+    } // SYMD_ISA_NAMESPACE
 } // namespace symd
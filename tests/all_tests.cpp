@@ -7,10 +7,21 @@
 #include "symd_register/symd_register_float_tests.h"
 #include "symd_register/symd_register_int_tests.h"
 #include "symd_register/symd_register_bfloat16_tests.h"
+#include "symd_register/symd_register_full_width_tests.h"
+#include "tensor/tensor_tests.h"
+#include "tensor/tensor_pool_tests.h"
 #include "stencil_borders/stencil_borders_tests.h"
+#include "kernel_functions/activation_tests.h"
 #include "kernel_functions/conversion_tests.h"
+#include "kernel_functions/fma_tests.h"
 #include "kernel_functions/exp_tests.h"
 #include "kernel_functions/log_tests.h"
+#include "kernel_functions/saturating_tests.h"
+#include "kernel_functions/trigonometric_tests.h"
 #include "map/broadcast_tests.h"
 #include "map/map_tests.h"
+#include "map/streaming_tests.h"
 #include "reduce/reduction_tests.h"
+#include "parallel/thread_pool_tests.h"
+#include "parallel/execution_policy_tests.h"
+#include "dispatch/cpu_dispatch_tests.h"
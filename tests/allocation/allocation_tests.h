@@ -0,0 +1,52 @@
+#pragma once
+#include "../test_helpers.h"
+
+
+namespace tests
+{
+    // Number of calls to global operator new, counted by replacement in test_allocation.cpp
+    extern std::atomic<size_t> numHeapAllocations;
+
+    TEST_CASE("Allocation - repeated parallel maps do not allocate")
+    {
+        symd::TensorPool pool;
+        auto shape = symd::Dimensions({ 240, 333 });
+
+        symd::Tensor<float> input(shape);
+        symd::Tensor<float> output(shape);
+
+        for (int64_t y = 0; y < shape[0]; y++)
+            for (int64_t x = 0; x < shape[1]; x++)
+                input[symd::Dimensions({ y, x })] = (float)(y + x);
+
+        // Small regions and explicit thread count, so every map is split and runs on worker threads
+        auto policy = symd::execution_policy().with_num_threads(4).with_min_region_size(2000);
+        auto tiledPolicy = policy.with_cache_blocking();
+
+        auto blur = [](const auto& sv) { return (sv(-1, 0) + sv(1, 0) + sv(0, -1) + sv(0, 1)) * 0.25f; };
+
+        std::vector<size_t> allocationsPerFrame;
+        allocationsPerFrame.reserve(10);
+
+        for (int frame = 0; frame < 10; frame++)
+        {
+            size_t allocationsBefore = numHeapAllocations;
+
+            auto stage1 = pool.acquire<float, 2>(shape);
+            auto stage2 = pool.acquire<float, 2>(shape);
+
+            symd::map(policy, stage1, [](auto x) { return x * 2.0f; }, input);
+            symd::map(tiledPolicy, stage2, blur, symd::views::stencil(stage1, symd::Dimensions({ 1, 1 })));
+            symd::map(policy, output, [](auto x, auto y) { return x + y; }, stage2, input);
+            symd::map_single_core(output, [](auto x) { return x - 1.0f; }, output);
+
+            allocationsPerFrame.push_back(numHeapAllocations - allocationsBefore);
+        }
+
+        // Region lists, worker queues and tensor pool are warmed up by first frame
+        for (int frame = 1; frame < 10; frame++)
+            REQUIRE(allocationsPerFrame[frame] == 0);
+
+        REQUIRE(output[symd::Dimensions({ 10, 20 })] == 30.0f * 2.0f + 30.0f - 1.0f);
+    }
+}
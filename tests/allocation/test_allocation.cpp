@@ -0,0 +1,70 @@
+#define CATCH_CONFIG_MAIN
+#include "../catch.h"
+
+#include <new>
+#include <atomic>
+#include <cstdlib>
+
+// Global allocation is replaced to count heap allocations of whole binary, so these tests have their own executable
+// (not included in all_tests.cpp). Every form of operator new and delete is replaced, so they always match.
+namespace tests
+{
+    std::atomic<size_t> numHeapAllocations{ 0 };
+
+    static void* countedAllocate(size_t size, size_t alignment)
+    {
+        numHeapAllocations++;
+
+        if (alignment < __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            alignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+        size = (size + alignment - 1) / alignment * alignment;
+
+#ifdef _WIN32
+        return _aligned_malloc(size > 0 ? size : alignment, alignment);
+#else
+        return std::aligned_alloc(alignment, size > 0 ? size : alignment);
+#endif
+    }
+
+    static void* countedAllocateOrThrow(size_t size, size_t alignment)
+    {
+        if (void* ptr = countedAllocate(size, alignment))
+            return ptr;
+
+        throw std::bad_alloc();
+    }
+
+    static void countedFree(void* ptr)
+    {
+#ifdef _WIN32
+        _aligned_free(ptr);
+#else
+        std::free(ptr);
+#endif
+    }
+}
+
+void* operator new(size_t size) { return tests::countedAllocateOrThrow(size, 0); }
+void* operator new[](size_t size) { return tests::countedAllocateOrThrow(size, 0); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return tests::countedAllocate(size, 0); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return tests::countedAllocate(size, 0); }
+void* operator new(size_t size, std::align_val_t al) { return tests::countedAllocateOrThrow(size, (size_t)al); }
+void* operator new[](size_t size, std::align_val_t al) { return tests::countedAllocateOrThrow(size, (size_t)al); }
+void* operator new(size_t size, std::align_val_t al, const std::nothrow_t&) noexcept { return tests::countedAllocate(size, (size_t)al); }
+void* operator new[](size_t size, std::align_val_t al, const std::nothrow_t&) noexcept { return tests::countedAllocate(size, (size_t)al); }
+
+void operator delete(void* ptr) noexcept { tests::countedFree(ptr); }
+void operator delete[](void* ptr) noexcept { tests::countedFree(ptr); }
+void operator delete(void* ptr, size_t) noexcept { tests::countedFree(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { tests::countedFree(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { tests::countedFree(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { tests::countedFree(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { tests::countedFree(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { tests::countedFree(ptr); }
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept { tests::countedFree(ptr); }
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept { tests::countedFree(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { tests::countedFree(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { tests::countedFree(ptr); }
+
+#include "allocation_tests.h"
@@ -130,4 +130,16 @@ namespace tests
         REQUIRE(res[1] == 32);
         REQUIRE(res[2] == 128);
     }
+
+    TEST_CASE("Dimensions: is native pitch")
+    {
+        auto shape = symd::Dimensions({3, 64, 128});
+
+        REQUIRE(shape.is_native_pitch(shape.native_pitch()));
+        REQUIRE(!shape.is_native_pitch(symd::Dimensions({64 * 256, 256, 1})));
+
+        // Pitch of dimensions with size one does not matter
+        auto singleRow = symd::Dimensions({1, 1, 128});
+        REQUIRE(singleRow.is_native_pitch(symd::Dimensions({999, 256, 1})));
+    }
 }
@@ -52,4 +52,91 @@ namespace tests
         REQUIRE(aligned_region.endCoord[1] == 10);
         REQUIRE(aligned_region.endCoord[2] == 32);
     }
+
+    TEST_CASE("Region split covers region exactly once")
+    {
+        auto region = symd::__internal__::Region(symd::Dimensions({3, 1080, 1920}));
+
+        std::vector<symd::__internal__::Region> regions;
+        region.split(regions);
+
+        REQUIRE(regions.size() > 1);
+
+        int64_t numElements = 0;
+
+        for (const auto& subRegion : regions)
+        {
+            REQUIRE(subRegion.num_elements() < 100000);
+            numElements += subRegion.num_elements();
+        }
+
+        // Sub regions are disjoint so they have to add up to the source region
+        REQUIRE(numElements == region.num_elements());
+    }
+
+    TEST_CASE("Region split with custom min region size")
+    {
+        auto region = symd::__internal__::Region(symd::Dimensions({7, 5}));
+
+        std::vector<symd::__internal__::Region> regions;
+        region.split(regions, 1);
+
+        // Every element ends up in its own region
+        REQUIRE(regions.size() == 35);
+
+        for (const auto& subRegion : regions)
+            REQUIRE(subRegion.num_elements() == 1);
+    }
+
+    TEST_CASE("Region tile covers region exactly once and fits cache")
+    {
+        auto region = symd::__internal__::Region(symd::Dimensions({ 2160, 3840 }));
+        auto border = symd::Dimensions({ 2, 2 });
+
+        std::vector<symd::__internal__::Region> tiles;
+        region.tile(tiles, border, 8, 48 * 1024, 2 * 1024 * 1024);
+
+        REQUIRE(tiles.size() > 1);
+
+        int64_t numElements = 0;
+
+        for (const auto& tile : tiles)
+        {
+            auto shape = tile.getShape();
+
+            // 5 rows of tile width fit in half of L1, tile with halo fits in half of L2
+            REQUIRE(5 * shape[1] * 8 <= 24 * 1024);
+            REQUIRE((shape[0] + 4) * (shape[1] + 4) * 8 <= 1024 * 1024);
+
+            numElements += tile.num_elements();
+        }
+
+        REQUIRE(numElements == region.num_elements());
+
+        // Neighbouring tiles come one after another
+        REQUIRE(tiles[0].startCoord[0] == tiles[1].startCoord[0]);
+        REQUIRE(tiles[0].endCoord[1] + 1 == tiles[1].startCoord[1]);
+    }
+
+    TEST_CASE("Region tile groups small planes")
+    {
+        auto region = symd::__internal__::Region(symd::Dimensions({ 1000, 8, 16 }));
+
+        std::vector<symd::__internal__::Region> tiles;
+        region.tile(tiles, symd::Dimensions({ 0, 1, 1 }), 4, 32 * 1024, 256 * 1024);
+
+        int64_t numElements = 0;
+
+        for (const auto& tile : tiles)
+        {
+            // Whole planes are tiled together
+            REQUIRE(tile.getShape()[1] == 8);
+            REQUIRE(tile.getShape()[2] == 16);
+
+            numElements += tile.num_elements();
+        }
+
+        REQUIRE(tiles.size() < 1000);
+        REQUIRE(numElements == region.num_elements());
+    }
 }
@@ -0,0 +1,31 @@
+#pragma once
+#include "../test_helpers.h"
+
+
+namespace tests
+{
+    TEST_CASE("CPU dispatch - detected instruction set")
+    {
+        // Binary compiled for some instruction set can only run on CPU supporting it
+        if constexpr (symd::compiled_isa() == symd::Isa::avx512)
+            REQUIRE(symd::detected_isa() == symd::Isa::avx512);
+
+        // Detection is cached
+        REQUIRE(symd::detected_isa() == symd::detected_isa());
+    }
+
+    TEST_CASE("CPU dispatch - select implementation")
+    {
+        using Impl = int (*)();
+
+        Impl avx2Impl = []() { return 8; };
+        Impl avx512Impl = []() { return 16; };
+
+        static const auto impl = symd::select_by_isa(avx2Impl, avx512Impl);
+
+        if (symd::detected_isa() == symd::Isa::avx512)
+            REQUIRE(impl() == 16);
+        else
+            REQUIRE(impl() == 8);
+    }
+}
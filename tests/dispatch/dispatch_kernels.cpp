@@ -0,0 +1,24 @@
+#include "../../LibSymd/symd.h"
+#include "dispatch_kernels.h"
+
+
+namespace SYMD_ISA_NAMESPACE
+{
+    int mapRegisterBytes(std::vector<float>& output, const std::vector<float>& input)
+    {
+        int registerBytes = 0;
+        symd::map(output, tests::RecordRegisterBytes{ &registerBytes }, input);
+
+        return registerBytes;
+    }
+
+    int64_t tensorRowPitch(int64_t width)
+    {
+        return symd::Tensor<double>(symd::Dimensions({ 2, width })).pitch()[0];
+    }
+
+    const void* threadPool()
+    {
+        return &symd::__internal__::ThreadPool::instance();
+    }
+}
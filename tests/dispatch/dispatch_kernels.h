@@ -0,0 +1,39 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+
+namespace tests
+{
+    /// <summary>
+    /// Kernel type shared by object files of all instruction sets, so map instantiated with it would get the same
+    /// name in every object file if map did not live in instruction set namespace. Records widest argument it got.
+    /// </summary>
+    struct RecordRegisterBytes
+    {
+        int* registerBytes;
+
+        template <typename X>
+        X operator()(const X& x) const
+        {
+            *registerBytes = std::max(*registerBytes, (int)sizeof(x));
+            return x * 2.0f;
+        }
+    };
+}
+
+// dispatch_kernels.cpp is compiled once per instruction set, see Makefile
+namespace isa_avx2
+{
+    int mapRegisterBytes(std::vector<float>& output, const std::vector<float>& input);
+    int64_t tensorRowPitch(int64_t width);
+    const void* threadPool();
+}
+
+namespace isa_avx512
+{
+    int mapRegisterBytes(std::vector<float>& output, const std::vector<float>& input);
+    int64_t tensorRowPitch(int64_t width);
+    const void* threadPool();
+}
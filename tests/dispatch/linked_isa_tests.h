@@ -0,0 +1,46 @@
+#pragma once
+#include "../test_helpers.h"
+#include "dispatch_kernels.h"
+
+
+namespace tests
+{
+    TEST_CASE("CPU dispatch - instruction sets linked into one binary")
+    {
+        std::vector<float> input(1024);
+        std::vector<float> output(input.size());
+
+        for (size_t i = 0; i < input.size(); i++)
+            input[i] = (float)i;
+
+        // Every object file runs its own map and Tensor code, not the copy linker kept from the other one.
+        // Namespaces are qualified, test helpers use symd::__internal__ which has isa_avx2 too.
+        REQUIRE(::isa_avx2::mapRegisterBytes(output, input) == 32);
+        REQUIRE(::isa_avx2::tensorRowPitch(3) == 8);
+
+        for (size_t i = 0; i < input.size(); i++)
+            REQUIRE(output[i] == 2.0f * i);
+
+        if (symd::detected_isa() == symd::Isa::avx512)
+        {
+            std::fill(output.begin(), output.end(), 0.0f);
+
+            REQUIRE(::isa_avx512::mapRegisterBytes(output, input) == 64);
+            REQUIRE(::isa_avx512::tensorRowPitch(3) == 16);
+
+            for (size_t i = 0; i < input.size(); i++)
+                REQUIRE(output[i] == 2.0f * i);
+        }
+
+        using MapRegisterBytes = int (*)(std::vector<float>&, const std::vector<float>&);
+
+        static const auto mapRegisterBytes = symd::select_by_isa<MapRegisterBytes>(::isa_avx2::mapRegisterBytes, ::isa_avx512::mapRegisterBytes);
+        REQUIRE(mapRegisterBytes(output, input) == (symd::detected_isa() == symd::Isa::avx512 ? 64 : 32));
+    }
+
+    TEST_CASE("CPU dispatch - instruction sets share thread pool")
+    {
+        // Thread pool does not depend on instruction set. Separate pools would pin their workers to the same cores.
+        REQUIRE(::isa_avx2::threadPool() == ::isa_avx512::threadPool());
+    }
+}
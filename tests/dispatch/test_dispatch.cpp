@@ -0,0 +1,5 @@
+#define CATCH_CONFIG_MAIN
+#include "../catch.h"
+
+#include "cpu_dispatch_tests.h"
+#include "linked_isa_tests.h"
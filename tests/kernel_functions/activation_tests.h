@@ -0,0 +1,121 @@
+#pragma once
+#include "../test_helpers.h"
+#include <cmath>
+
+
+namespace tests
+{
+    template <typename T, typename KernelFunc, typename RefFunc>
+    void require_activation_near(KernelFunc&& kernel, RefFunc&& reference, double eps)
+    {
+        // Odd size exercises scalar tail, range covers saturation of all functions
+        std::vector<T> input(1001);
+
+        for (size_t i = 0; i < input.size(); i++)
+            input[i] = (T)(-30.0 + 60.0 * i / (input.size() - 1));
+
+        std::vector<T> output(input.size());
+        symd::map_single_core(output, kernel, input);
+
+        for (size_t i = 0; i < input.size(); i++)
+        {
+            double ref = reference((double)input[i]);
+
+            // Relative to reference for large values, absolute near 0
+            double tolerance = eps * std::max(1.0, std::abs(ref));
+
+            REQUIRE(std::abs((double)output[i] - ref) <= tolerance);
+            REQUIRE(std::abs((double)kernel(input[i]) - ref) <= tolerance);
+        }
+    }
+
+
+    TEMPLATE_TEST_CASE("Mapping activation functions", "", float, double)
+    {
+        const double eps = 5e-5;
+
+        require_activation_near<TestType>([](auto x) { return symd::kernel::sigmoid(x); },
+            [](double x) { return 1.0 / (1.0 + std::exp(-x)); }, eps);
+
+        require_activation_near<TestType>([](auto x) { return symd::kernel::tanh(x); },
+            [](double x) { return std::tanh(x); }, eps);
+
+        require_activation_near<TestType>([](auto x) { return symd::kernel::erf(x); },
+            [](double x) { return std::erf(x); }, eps);
+
+        require_activation_near<TestType>([](auto x) { return symd::kernel::softplus(x); },
+            [](double x) { return std::log1p(std::exp(x)); }, eps);
+
+        require_activation_near<TestType>([](auto x) { return symd::kernel::gelu(x); },
+            [](double x) { return 0.5 * x * (1.0 + std::erf(x / std::sqrt(2.0))); }, eps);
+
+        require_activation_near<TestType>([](auto x) { return symd::kernel::gelu_tanh(x); },
+            [](double x) { return 0.5 * x * (1.0 + std::tanh(0.7978845608028654 * (x + 0.044715 * x * x * x))); }, eps);
+    }
+
+
+    TEST_CASE("Mapping activation functions bfloat16")
+    {
+        // bfloat16 has 8 bits of mantissa
+        const double eps = 1e-2;
+
+        require_activation_near<symd::bfloat16>([](auto x) { return symd::kernel::sigmoid(x); },
+            [](double x) { return 1.0 / (1.0 + std::exp(-x)); }, eps);
+
+        require_activation_near<symd::bfloat16>([](auto x) { return symd::kernel::tanh(x); },
+            [](double x) { return std::tanh(x); }, eps);
+
+        require_activation_near<symd::bfloat16>([](auto x) { return symd::kernel::gelu(x); },
+            [](double x) { return 0.5 * x * (1.0 + std::erf(x / std::sqrt(2.0))); }, eps);
+
+        require_activation_near<symd::bfloat16>([](auto x) { return symd::kernel::softplus(x); },
+            [](double x) { return std::log1p(std::exp(x)); }, eps);
+    }
+
+
+    TEST_CASE("Mapping - activation speed")
+    {
+        std::vector<float> input(2000000);
+        std::vector<float> output(input.size());
+
+        for (size_t i = 0; i < input.size(); i++)
+            input[i] = -8.0f + 16.0f * i / input.size();
+
+        auto durationSymdSingleCore = helpers::measure_execution_time_ms([&]()
+            {
+                symd::map_single_core(output, [](const auto& x)
+                    {
+                        return symd::kernel::sigmoid(x);
+                    }, input);
+            }
+        );
+
+        auto durationLoop = helpers::measure_execution_time_ms([&]()
+            {
+                for (size_t i = 0; i < input.size(); i++)
+                    output[i] = 1.0f / (1.0f + expf(-input[i]));
+            }
+        );
+
+        auto durationGeluSymd = helpers::measure_execution_time_ms([&]()
+            {
+                symd::map_single_core(output, [](const auto& x)
+                    {
+                        return symd::kernel::gelu(x);
+                    }, input);
+            }
+        );
+
+        auto durationGeluLoop = helpers::measure_execution_time_ms([&]()
+            {
+                for (size_t i = 0; i < input.size(); i++)
+                    output[i] = 0.5f * input[i] * (1.0f + erff(input[i] * 0.70710678f));
+            }
+        );
+
+        std::cout << "sigmoid(x) - Loop             : " << durationLoop.count() << " ms" << std::endl;
+        std::cout << "sigmoid(x) - symd_single_core : " << durationSymdSingleCore.count() << " ms" << std::endl;
+        std::cout << "gelu(x) - Loop                : " << durationGeluLoop.count() << " ms" << std::endl;
+        std::cout << "gelu(x) - symd_single_core    : " << durationGeluSymd.count() << " ms" << std::endl;
+    }
+}
@@ -256,5 +256,107 @@ namespace tests
 
         std::cout << "exp(x) - Loop             : " << durationLoop.count() << " ms" << std::endl;
         std::cout << "exp(x) - symd_single_core : " << durationSymdSingleCore.count() << " ms" << std::endl;
+
+        // Compute bound case for unrolling, block which stays in L1/L2 cache is processed repeatedly. Unroll 2 and 4
+        // gave no consistent gain over 1, it depends on core and kernel.
+        std::vector<float> block(input.begin(), input.begin() + 8192);
+        std::vector<float> blockOutput(block.size());
+        std::vector<float> reference(block.size());
+
+        for (int unroll : { 1, 2, 4 })
+        {
+            auto policy = symd::single_core_policy().with_unroll(unroll);
+
+            auto durationUnrolled = helpers::measure_execution_time_ms([&]()
+                {
+                    for (int pass = 0; pass < 100; pass++)
+                        symd::map_single_core(policy, blockOutput, [](const auto& x)
+                            {
+                                return symd::kernel::exp(x);
+                            }, block);
+                }
+            );
+
+            std::cout << "exp(x) - cached, unroll " << unroll << " : " << durationUnrolled.count() << " ms" << std::endl;
+
+            if (unroll == 1)
+                reference = blockOutput;
+
+            helpers::require_equal(blockOutput, reference);
+        }
+    }
+
+    template <typename Accuracy, typename T>
+    void exp_tier_errors(double lo, double hi, double& maxUlp, double& maxRel)
+    {
+        std::vector<T> input(100001);
+        std::vector<T> output(input.size());
+
+        for (size_t i = 0; i < input.size(); i++)
+            input[i] = (T)(lo + (hi - lo) * i / (input.size() - 1));
+
+        symd::map_single_core(output, [](auto x)
+            {
+                return symd::kernel::exp<Accuracy>(x);
+            }, input);
+
+        maxUlp = 0;
+        maxRel = 0;
+
+        for (size_t i = 0; i < input.size(); i++)
+        {
+            long double ref = std::exp((long double)input[i]);
+            T scalar = symd::kernel::exp<Accuracy>(input[i]);
+
+            maxUlp = std::max({ maxUlp, helpers::ulp_error(output[i], ref), helpers::ulp_error(scalar, ref) });
+            maxRel = std::max({ maxRel, (double)(std::abs(output[i] - ref) / ref), (double)(std::abs(scalar - ref) / ref) });
+        }
+    }
+
+    TEST_CASE("Mapping exp accuracy tiers float")
+    {
+        double maxUlp, maxRel;
+
+        exp_tier_errors<symd::fast, float>(-87.0, 88.0, maxUlp, maxRel);
+        REQUIRE(maxRel <= 1e-3);
+
+        exp_tier_errors<symd::standard, float>(-80.0, 80.0, maxUlp, maxRel);
+        REQUIRE(maxRel <= 5e-5);
+
+        exp_tier_errors<symd::precise, float>(-87.0, 88.7, maxUlp, maxRel);
+        REQUIRE(maxUlp <= 2.0);
+
+        // Overflow and underflow saturate
+        REQUIRE(std::isinf(symd::kernel::exp<symd::precise>(100.0f)));
+        REQUIRE(symd::kernel::exp<symd::precise>(-110.0f) == 0.0f);
+    }
+
+    TEST_CASE("Mapping exp accuracy tiers double")
+    {
+        double maxUlp, maxRel;
+
+        exp_tier_errors<symd::fast, double>(-700.0, 700.0, maxUlp, maxRel);
+        REQUIRE(maxRel <= 1e-3);
+
+        exp_tier_errors<symd::precise, double>(-708.0, 709.7, maxUlp, maxRel);
+        REQUIRE(maxUlp <= 2.0);
+    }
+
+    TEST_CASE("Mapping exp precise bfloat16")
+    {
+        std::vector<symd::bfloat16> input = { -20.5, -3.25, -1, -0.5, 0, 0.125, 0.5, 1, 2.5, 7, 15.5, 40 };
+        std::vector<symd::bfloat16> output(input.size());
+
+        symd::map_single_core(output, [](auto x)
+            {
+                return symd::kernel::exp<symd::precise>(x);
+            }, input);
+
+        for (size_t i = 0; i < input.size(); i++)
+        {
+            // Computed in float, only final rounding to bfloat16 remains
+            float ref = std::exp((float)input[i]);
+            REQUIRE(std::abs((float)output[i] - ref) <= ref * 1e-2f);
+        }
     }
 }
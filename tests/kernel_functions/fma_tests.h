@@ -0,0 +1,65 @@
+#pragma once
+#include "../test_helpers.h"
+#include <cmath>
+
+
+namespace tests
+{
+    TEMPLATE_TEST_CASE("Mapping fma", "", float, double)
+    {
+        std::vector<TestType> a(37), b(37), c(37), output(37);
+
+        for (size_t i = 0; i < a.size(); i++)
+        {
+            a[i] = (TestType)(i * 0.37 - 5.0);
+            b[i] = (TestType)(2.5 - i * 0.11);
+            c[i] = (TestType)(i % 5) - (TestType)1.5;
+        }
+
+        symd::map_single_core(output, [](auto x, auto y, auto z)
+            {
+                return symd::kernel::fma(x, y, z);
+            }, a, b, c);
+
+        for (size_t i = 0; i < output.size(); i++)
+        {
+            // Vector and scalar tail have to round equally
+            REQUIRE(output[i] == symd::kernel::fma(a[i], b[i], c[i]));
+            REQUIRE(std::abs(output[i] - (a[i] * b[i] + c[i])) <= 1e-5);
+        }
+    }
+
+    TEST_CASE("Mapping fma with scalar operands")
+    {
+        std::vector<float> input = { -3.0f, -1.5f, 0.0f, 0.25f, 1.0f, 2.0f, 7.5f, 100.0f, -42.0f };
+        std::vector<float> output(input.size());
+
+        symd::map_single_core(output, [](auto x)
+            {
+                return symd::kernel::fma(x, 3.0f, symd::kernel::fma(2.0f, x, 1.0f));
+            }, input);
+
+        for (size_t i = 0; i < output.size(); i++)
+            REQUIRE(output[i] == 5.0f * input[i] + 1.0f);
+    }
+
+#ifdef SYMD_FMA
+    TEST_CASE("Mapping fma rounds once")
+    {
+        // (1 + 2^-12)^2 = 1 + 2^-11 + 2^-24, last term is lost when product is rounded to float
+        float a = 1.0f + std::ldexp(1.0f, -12);
+        float c = -(1.0f + std::ldexp(1.0f, -11));
+
+        std::vector<float> input(17, a);
+        std::vector<float> output(input.size());
+
+        symd::map_single_core(output, [c](auto x)
+            {
+                return symd::kernel::fma(x, x, c);
+            }, input);
+
+        for (size_t i = 0; i < output.size(); i++)
+            REQUIRE(output[i] == std::ldexp(1.0f, -24));
+    }
+#endif
+}
@@ -112,8 +112,8 @@ namespace tests
         std::vector<float> input(2000000);
         std::vector<float> output(input.size());
 
-        // initialize input
-        //symd::map_single_core(input, [](){ return 1; });
+        // Positive inputs, log of zero is not finite
+        helpers::randomize_data(input);
 
         // Pass computation to measure time function. It fill execute it multiple times to measure time correctly.
         auto durationSymdSingleCore = helpers::measure_execution_time_ms([&]()
@@ -135,5 +135,82 @@ namespace tests
 
         std::cout << "log(x) - Loop             : " << durationLoop.count() << " ms" << std::endl;
         std::cout << "log(x) - symd_single_core : " << durationSymdSingleCore.count() << " ms" << std::endl;
+
+        // Compute bound case for unrolling, block which stays in L1/L2 cache is processed repeatedly. Unroll 2 and 4
+        // gave no consistent gain over 1, it depends on core and kernel.
+        std::vector<float> block(input.begin(), input.begin() + 8192);
+        std::vector<float> blockOutput(block.size());
+        std::vector<float> reference(block.size());
+
+        for (int unroll : { 1, 2, 4 })
+        {
+            auto policy = symd::single_core_policy().with_unroll(unroll);
+
+            auto durationUnrolled = helpers::measure_execution_time_ms([&]()
+                {
+                    for (int pass = 0; pass < 100; pass++)
+                        symd::map_single_core(policy, blockOutput, [](const auto& x)
+                            {
+                                return symd::kernel::log(x);
+                            }, block);
+                }
+            );
+
+            std::cout << "log(x) - cached, unroll " << unroll << " : " << durationUnrolled.count() << " ms" << std::endl;
+
+            if (unroll == 1)
+                reference = blockOutput;
+
+            helpers::require_equal(blockOutput, reference);
+        }
+    }
+
+    TEST_CASE("Mapping log accuracy tiers")
+    {
+        // Logarithmically spaced over normal and subnormal floats, plus dense sampling around 1
+        std::vector<float> input;
+
+        for (int i = 0; i <= 100000; i++)
+            input.push_back(std::pow(10.0f, -44.0f + 82.0f * i / 100000));
+
+        for (int i = 0; i <= 2000; i++)
+            input.push_back(0.5f + i * 0.0005f);
+
+        auto maxErrors = [&](auto accuracy, double& maxUlp, double& maxAbs)
+        {
+            using Accuracy = decltype(accuracy);
+            std::vector<float> output(input.size());
+
+            symd::map_single_core(output, [](auto x)
+                {
+                    return symd::kernel::log<Accuracy>(x);
+                }, input);
+
+            maxUlp = 0;
+            maxAbs = 0;
+
+            for (size_t i = 0; i < input.size(); i++)
+            {
+                long double ref = std::log((long double)input[i]);
+                float scalar = symd::kernel::log<Accuracy>(input[i]);
+
+                maxAbs = std::max({ maxAbs, (double)std::abs(output[i] - ref), (double)std::abs(scalar - ref) });
+
+                if (input[i] >= std::numeric_limits<float>::min())
+                    maxUlp = std::max({ maxUlp, helpers::ulp_error(output[i], ref), helpers::ulp_error(scalar, ref) });
+            }
+        };
+
+        double maxUlp, maxAbs;
+
+        maxErrors(symd::fast(), maxUlp, maxAbs);
+        REQUIRE(maxAbs <= 2e-3);
+
+        maxErrors(symd::standard(), maxUlp, maxAbs);
+        REQUIRE(maxAbs <= 1e-4);
+
+        maxErrors(symd::precise(), maxUlp, maxAbs);
+        REQUIRE(maxUlp <= 2.0);
+        REQUIRE(maxAbs <= 1e-5);
     }
 }
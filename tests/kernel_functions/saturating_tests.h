@@ -0,0 +1,51 @@
+#pragma once
+#include "../test_helpers.h"
+#include <algorithm>
+#include <limits>
+
+
+namespace tests
+{
+    TEMPLATE_TEST_CASE("Mapping saturating arithmetic", "", unsigned char, int16_t, uint16_t)
+    {
+        constexpr int lo = std::numeric_limits<TestType>::min();
+        constexpr int hi = std::numeric_limits<TestType>::max();
+
+        // Values near both ends of range overflow in both directions
+        std::vector<TestType> a(53), b(53);
+
+        for (size_t i = 0; i < a.size(); i++)
+        {
+            a[i] = (TestType)(i % 2 ? hi - (int)i * 3 : lo + (int)i * 5);
+            b[i] = (TestType)(i % 3 ? hi - (int)i * 7 : lo + (int)i);
+        }
+
+        std::vector<TestType> sums(a.size()), diffs(a.size()), avgs(a.size());
+
+        symd::map_single_core(sums, [](auto x, auto y) { return symd::kernel::adds(x, y); }, a, b);
+        symd::map_single_core(diffs, [](auto x, auto y) { return symd::kernel::subs(x, y); }, a, b);
+        symd::map_single_core(avgs, [](auto x, auto y) { return symd::kernel::avg(x, y); }, a, b);
+
+        for (size_t i = 0; i < a.size(); i++)
+        {
+            REQUIRE((int)sums[i] == std::clamp((int)a[i] + (int)b[i], lo, hi));
+            REQUIRE((int)diffs[i] == std::clamp((int)a[i] - (int)b[i], lo, hi));
+            REQUIRE((int)avgs[i] == ((int)a[i] + (int)b[i] + 1) >> 1);
+        }
+    }
+
+    TEST_CASE("Mapping 8 bit brightness and blend")
+    {
+        std::vector<unsigned char> frame1 = { 0, 10, 100, 200, 215, 216, 250, 255, 3, 128, 129 };
+        std::vector<unsigned char> frame2 = { 255, 0, 101, 200, 0, 1, 251, 254, 4, 127, 0 };
+        std::vector<unsigned char> brighter(frame1.size()), darker(frame1.size()), blended(frame1.size());
+
+        symd::map_single_core(brighter, [](auto x) { return symd::kernel::adds(x, (unsigned char)40); }, frame1);
+        symd::map_single_core(darker, [](auto x) { return symd::kernel::subs(x, (unsigned char)40); }, frame1);
+        symd::map_single_core(blended, [](auto x, auto y) { return symd::kernel::avg(x, y); }, frame1, frame2);
+
+        helpers::require_equal(brighter, { 40, 50, 140, 240, 255, 255, 255, 255, 43, 168, 169 });
+        helpers::require_equal(darker, { 0, 0, 60, 160, 175, 176, 210, 215, 0, 88, 89 });
+        helpers::require_equal(blended, { 128, 5, 101, 200, 108, 109, 251, 255, 4, 128, 65 });
+    }
+}
@@ -1,6 +1,10 @@
 #define CATCH_CONFIG_MAIN
 #include "../catch.h"
 
+#include "activation_tests.h"
 #include "conversion_tests.h"
+#include "fma_tests.h"
 #include "exp_tests.h"
 #include "log_tests.h"
+#include "saturating_tests.h"
+#include "trigonometric_tests.h"
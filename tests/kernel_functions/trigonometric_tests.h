@@ -0,0 +1,112 @@
+#pragma once
+#include "../test_helpers.h"
+#include <cmath>
+
+
+namespace tests
+{
+    template <typename T>
+    std::vector<T> trig_test_input(int count, double range)
+    {
+        std::vector<T> input(count);
+
+        for (int i = 0; i < count; i++)
+            input[i] = (T)(-range + 2.0 * range * i / (count - 1));
+
+        return input;
+    }
+
+
+    TEMPLATE_TEST_CASE("Mapping sin and cos", "", float, double)
+    {
+        // Odd size also exercises scalar tail; includes quadrant boundaries +-k * pi/4
+        auto input = trig_test_input<TestType>(2001, 100.0);
+
+        for (int k = -8; k <= 8; k++)
+            input.push_back((TestType)(k * 0.78539816339744830962));
+
+        std::vector<TestType> sinOut(input.size()), cosOut(input.size());
+
+        symd::map_single_core(sinOut, [](auto x) { return symd::kernel::sin(x); }, input);
+        symd::map_single_core(cosOut, [](auto x) { return symd::kernel::cos(x); }, input);
+
+        const TestType eps = std::is_same_v<TestType, float> ? (TestType)4e-7 : (TestType)1e-15;
+
+        for (size_t i = 0; i < input.size(); i++)
+        {
+            REQUIRE(std::abs(sinOut[i] - std::sin(input[i])) <= eps);
+            REQUIRE(std::abs(cosOut[i] - std::cos(input[i])) <= eps);
+            REQUIRE(std::abs(symd::kernel::sin(input[i]) - std::sin(input[i])) <= eps);
+            REQUIRE(std::abs(symd::kernel::cos(input[i]) - std::cos(input[i])) <= eps);
+        }
+    }
+
+
+    TEST_CASE("Mapping sin and cos bfloat16")
+    {
+        auto input = trig_test_input<symd::bfloat16>(301, 10.0);
+        std::vector<symd::bfloat16> sinOut(input.size()), cosOut(input.size());
+
+        symd::map_single_core(sinOut, [](auto x) { return symd::kernel::sin(x); }, input);
+        symd::map_single_core(cosOut, [](auto x) { return symd::kernel::cos(x); }, input);
+
+        for (size_t i = 0; i < input.size(); i++)
+        {
+            float x = (float)input[i];
+
+            REQUIRE(std::abs((float)sinOut[i] - std::sin(x)) <= 4e-3f);
+            REQUIRE(std::abs((float)cosOut[i] - std::cos(x)) <= 4e-3f);
+            REQUIRE(std::abs((float)symd::kernel::sin(input[i]) - std::sin(x)) <= 4e-3f);
+        }
+    }
+
+
+    TEST_CASE("Mapping sincos to polar coordinates")
+    {
+        auto phase = trig_test_input<float>(1003, 20.0);
+        std::vector<float> radius(phase.size(), 2.5f);
+
+        std::array<std::vector<float>, 2> out = {
+            std::vector<float>(phase.size()),
+            std::vector<float>(phase.size())
+        };
+
+        symd::map(out, [](auto r, auto phi)
+            {
+                auto sc = symd::kernel::sincos(phi);
+                return std::array{ r * sc[1], r * sc[0] };
+            }, radius, phase);
+
+        for (size_t i = 0; i < phase.size(); i++)
+        {
+            REQUIRE(std::abs(out[0][i] - 2.5f * std::cos(phase[i])) <= 1e-6f);
+            REQUIRE(std::abs(out[1][i] - 2.5f * std::sin(phase[i])) <= 1e-6f);
+        }
+    }
+
+
+    TEST_CASE("Mapping - sin speed")
+    {
+        auto input = trig_test_input<float>(2000000, 100.0);
+        std::vector<float> output(input.size());
+
+        auto durationSymdSingleCore = helpers::measure_execution_time_ms([&]()
+            {
+                symd::map_single_core(output, [](const auto& x)
+                    {
+                        return symd::kernel::sin(x);
+                    }, input);
+            }
+        );
+
+        auto durationLoop = helpers::measure_execution_time_ms([&]()
+            {
+                for (size_t i = 0; i < input.size(); i++)
+                    output[i] = sinf(input[i]);
+            }
+        );
+
+        std::cout << "sin(x) - Loop             : " << durationLoop.count() << " ms" << std::endl;
+        std::cout << "sin(x) - symd_single_core : " << durationSymdSingleCore.count() << " ms" << std::endl;
+    }
+}
@@ -3,16 +3,153 @@
 
 namespace tests
 {
-    TEST_CASE("Tensor 1")
+    TEST_CASE("Broadcast - bias add")
     {
-        // symd::Tensor<float> input(symd::Dimensions({ 1, 1, 256, 64 }));
-        // symd::Tensor<float> output(input.shape());
+        // Bias of shape { C } is added to every row of { N, C } input
+        const int64_t N = 5, C = 37;
 
-        // symd::map_single_core(input, [](auto x) { return x - x + 1.0f; }, input);
+        std::vector<float> input(N * C);
+        std::vector<float> bias(C);
+        std::vector<float> output(N * C);
 
-        // symd::map_single_core(output, [](auto x) { return x * 2; }, input);
+        for (size_t i = 0; i < input.size(); i++)
+            input[i] = (float)i;
 
-        // std::cout << "--------------------------> Done" << std::endl;
-        // // helpers::require_equal(output, { 2, 4, 6, 8, 10, 12, 14, 16, 18 });
+        for (size_t i = 0; i < bias.size(); i++)
+            bias[i] = 1000.0f * (float)i;
+
+        auto shape = symd::Dimensions({ N, C });
+        auto in = symd::views::data_view<float, 2>(input.data(), shape, shape.native_pitch());
+        auto out = symd::views::data_view<float, 2>(output.data(), shape, shape.native_pitch());
+
+        symd::map_single_core(out, [](auto x, auto b) { return x + b; }, in, symd::views::broadcast(bias, shape));
+
+        for (int64_t n = 0; n < N; n++)
+            for (int64_t c = 0; c < C; c++)
+                REQUIRE(output[n * C + c] == input[n * C + c] + bias[c]);
+    }
+
+    TEST_CASE("Broadcast - per row scaling splats last dimension")
+    {
+        const int64_t N = 7, W = 45;
+
+        std::vector<int> input(N * W);
+        std::vector<int> scale(N);
+        std::vector<int> output(N * W);
+
+        for (size_t i = 0; i < input.size(); i++)
+            input[i] = (int)i;
+
+        for (size_t i = 0; i < scale.size(); i++)
+            scale[i] = (int)i + 2;
+
+        auto shape = symd::Dimensions({ N, W });
+        auto in = symd::views::data_view<int, 2>(input.data(), shape, shape.native_pitch());
+        auto out = symd::views::data_view<int, 2>(output.data(), shape, shape.native_pitch());
+        auto scaleView = symd::views::data_view<int, 2>(scale.data(), symd::Dimensions({ N, 1 }), symd::Dimensions({ 1, 1 }));
+
+        symd::map_single_core(out, [](auto x, auto s) { return x * s; }, in, symd::views::broadcast(scaleView, shape));
+
+        for (int64_t n = 0; n < N; n++)
+            for (int64_t w = 0; w < W; w++)
+                REQUIRE(output[n * W + w] == input[n * W + w] * scale[n]);
+    }
+
+    TEST_CASE("Broadcast - middle dimension and missing leading dimensions")
+    {
+        const int64_t B = 2, H = 3, W = 19;
+
+        std::vector<int> input(B * H * W);
+        std::vector<int> perImage(B * W);   // { B, 1, W }
+        std::vector<int> perColumn(W);      // { W }
+        std::vector<int> output(input.size());
+
+        for (size_t i = 0; i < input.size(); i++)
+            input[i] = (int)i;
+
+        for (size_t i = 0; i < perImage.size(); i++)
+            perImage[i] = (int)i * 100;
+
+        for (size_t i = 0; i < perColumn.size(); i++)
+            perColumn[i] = (int)i * 10000;
+
+        auto shape = symd::Dimensions({ B, H, W });
+        auto imageShape = symd::Dimensions({ B, 1, W });
+
+        auto in = symd::views::data_view<int, 3>(input.data(), shape, shape.native_pitch());
+        auto out = symd::views::data_view<int, 3>(output.data(), shape, shape.native_pitch());
+        auto imageView = symd::views::data_view<int, 3>(perImage.data(), imageShape, imageShape.native_pitch());
+
+        symd::map_single_core(out, [](auto x, auto img, auto col) { return x + img + col; },
+            in, symd::views::broadcast(imageView, shape), symd::views::broadcast(perColumn, shape));
+
+        for (int64_t b = 0; b < B; b++)
+            for (int64_t h = 0; h < H; h++)
+                for (int64_t w = 0; w < W; w++)
+                {
+                    int64_t i = (b * H + h) * W + w;
+                    REQUIRE(output[i] == input[i] + perImage[b * W + w] + perColumn[w]);
+                }
+    }
+
+    TEST_CASE("Broadcast - row normalization on multiple threads")
+    {
+        const int64_t N = 300, W = 1000;
+
+        std::vector<float> input(N * W);
+        std::vector<float> mean(N);
+        std::vector<float> invStd(N);
+        std::vector<float> output(N * W);
+
+        helpers::randomize_data(input);
+
+        for (int64_t n = 0; n < N; n++)
+        {
+            mean[n] = (float)n;
+            invStd[n] = 1.0f / (float)(n + 1);
+        }
+
+        auto shape = symd::Dimensions({ N, W });
+        auto rowsShape = symd::Dimensions({ N, 1 });
+
+        auto in = symd::views::data_view<float, 2>(input.data(), shape, shape.native_pitch());
+        auto out = symd::views::data_view<float, 2>(output.data(), shape, shape.native_pitch());
+        auto meanView = symd::views::data_view<float, 2>(mean.data(), rowsShape, rowsShape.native_pitch());
+        auto invStdView = symd::views::data_view<float, 2>(invStd.data(), rowsShape, rowsShape.native_pitch());
+
+        // Regions of multi threaded map are sub views of broadcast views
+        symd::map(out, [](auto x, auto m, auto s) { return (x - m) * s; },
+            in, symd::views::broadcast(meanView, shape), symd::views::broadcast(invStdView, shape));
+
+        for (int64_t n = 0; n < N; n++)
+            for (int64_t w = 0; w < W; w++)
+                REQUIRE(output[n * W + w] == (input[n * W + w] - mean[n]) * invStd[n]);
+    }
+
+    TEST_CASE("Broadcast - unsigned char")
+    {
+        const int64_t N = 4, W = 100;
+
+        std::vector<unsigned char> input(N * W);
+        std::vector<unsigned char> offset(N);
+        std::vector<unsigned char> output(N * W);
+
+        for (size_t i = 0; i < input.size(); i++)
+            input[i] = (unsigned char)(i * 3);
+
+        for (size_t i = 0; i < offset.size(); i++)
+            offset[i] = (unsigned char)(i * 60);
+
+        auto shape = symd::Dimensions({ N, W });
+        auto in = symd::views::data_view<unsigned char, 2>(input.data(), shape, shape.native_pitch());
+        auto out = symd::views::data_view<unsigned char, 2>(output.data(), shape, shape.native_pitch());
+        auto offsetView = symd::views::data_view<unsigned char, 2>(offset.data(), symd::Dimensions({ N, 1 }), symd::Dimensions({ 1, 1 }));
+
+        // Saturating add of unsigned char registers
+        symd::map_single_core(out, [](auto x, auto o) { return x + o; }, in, symd::views::broadcast(offsetView, shape));
+
+        for (int64_t n = 0; n < N; n++)
+            for (int64_t w = 0; w < W; w++)
+                REQUIRE(output[n * W + w] == std::min(input[n * W + w] + offset[n], 255));
     }
 }
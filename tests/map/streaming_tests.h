@@ -0,0 +1,144 @@
+#pragma once
+#include "../test_helpers.h"
+
+namespace tests
+{
+    TEST_CASE("Streaming - same results as regular stores")
+    {
+        for (int64_t width : { 1, 15, 16, 17, 100, 1001 })
+        {
+            auto shape = symd::Dimensions({ 3, width });
+
+            symd::Tensor<float> input(shape);
+            symd::Tensor<float> output(shape);
+            symd::Tensor<symd::bfloat16> outputBf16(shape);
+
+            std::vector<double> outputVec(shape.num_elements() + 1);
+            auto outView = symd::views::data_view<double, 2>(outputVec.data() + 1, shape, shape.native_pitch());
+
+            for (int64_t y = 0; y < shape[0]; y++)
+                for (int64_t x = 0; x < width; x++)
+                    input[symd::Dimensions({ y, x })] = (float)(y * 10000 + x) * 0.25f;
+
+            auto streamingOut = symd::views::streaming(output);
+            auto streamingBf16 = symd::views::streaming(outputBf16);
+            auto streamingUnaligned = symd::views::streaming(outView);
+
+            symd::map_single_core(streamingOut, [](auto x) { return x * 2.0f; }, input);
+
+            symd::map_single_core(streamingBf16, [](auto x)
+                {
+                    return symd::kernel::convert_to<symd::bfloat16>(x);
+                }, input);
+
+            // Unaligned rows fall back to regular stores
+            symd::map_single_core(streamingUnaligned, [](auto x)
+                {
+                    return symd::kernel::convert_to<double>(x) + 1.0;
+                }, input);
+
+            for (int64_t y = 0; y < shape[0]; y++)
+                for (int64_t x = 0; x < width; x++)
+                {
+                    auto c = symd::Dimensions({ y, x });
+
+                    REQUIRE(output[c] == input[c] * 2.0f);
+                    REQUIRE((float)outputBf16[c] == (float)symd::bfloat16(input[c]));
+                    REQUIRE(outputVec[y * width + x + 1] == (double)input[c] + 1.0);
+                }
+        }
+    }
+
+    TEST_CASE("Streaming - integer types and parallel map")
+    {
+        auto shape = symd::Dimensions({ 400, 999 });
+
+        symd::Tensor<int> input(shape);
+        symd::Tensor<int> output(shape);
+        symd::Tensor<unsigned char> outputBytes(shape);
+        std::vector<unsigned char> inputBytes(shape.num_elements());
+
+        for (int64_t y = 0; y < shape[0]; y++)
+            for (int64_t x = 0; x < shape[1]; x++)
+            {
+                input[symd::Dimensions({ y, x })] = (int)(y * x);
+                inputBytes[y * shape[1] + x] = (unsigned char)(y + x);
+            }
+
+        auto inBytesView = symd::views::data_view<unsigned char, 2>(inputBytes.data(), shape, shape.native_pitch());
+
+        auto streamingOut = symd::views::streaming(output);
+        auto streamingBytes = symd::views::streaming(outputBytes);
+
+        symd::map(streamingOut, [](auto x) { return x * 3 - 7; }, input);
+        symd::map(streamingBytes, [](auto x) { return x + x; }, inBytesView);
+
+        for (int64_t y = 0; y < shape[0]; y++)
+            for (int64_t x = 0; x < shape[1]; x++)
+            {
+                auto c = symd::Dimensions({ y, x });
+
+                REQUIRE(output[c] == (int)(y * x) * 3 - 7);
+                REQUIRE(outputBytes[c] == std::min(2 * inputBytes[y * shape[1] + x], 255));
+            }
+    }
+
+    TEST_CASE("Streaming - large conversion speed")
+    {
+        auto shape = symd::Dimensions({ 4096, 4096 });
+
+        symd::Tensor<float> input(shape);
+        symd::Tensor<symd::bfloat16> output(shape);
+
+        auto streamingOut = symd::views::streaming(output);
+        auto convert = [](auto x) { return symd::kernel::convert_to<symd::bfloat16>(x); };
+
+        auto durationRegular = helpers::measure_execution_time_ms([&]()
+            {
+                symd::map(output, convert, input);
+            }, 20);
+
+        auto durationStreaming = helpers::measure_execution_time_ms([&]()
+            {
+                symd::map(streamingOut, convert, input);
+            }, 20);
+
+        std::cout << "Convert float -> bfloat16 (64 MB) - regular stores   : " << durationRegular.count() << " ms" << std::endl;
+        std::cout << "Convert float -> bfloat16 (64 MB) - streaming stores : " << durationStreaming.count() << " ms" << std::endl;
+    }
+
+    TEST_CASE("Streaming - large write bound map speed")
+    {
+        auto shape = symd::Dimensions({ 4096, 4096 });
+
+        symd::Tensor<float> input(shape);
+        symd::Tensor<float> output(shape);
+        symd::Tensor<float> outputStreaming(shape);
+
+        for (int64_t y = 0; y < shape[0]; y += 97)
+            for (int64_t x = 0; x < shape[1]; x += 13)
+                input[symd::Dimensions({ y, x })] = (float)(y + x);
+
+        auto streamingOut = symd::views::streaming(outputStreaming);
+        auto scale = [](auto x) { return x * 0.5f; };
+
+        // Output is as big as input, so regular stores spend third of bandwidth on reading output lines
+        // before they are overwritten. Streaming stores skip that read.
+        auto durationRegular = helpers::measure_execution_time_ms([&]()
+            {
+                symd::map_single_core(output, scale, input);
+            }, 20);
+
+        auto durationStreaming = helpers::measure_execution_time_ms([&]()
+            {
+                symd::map_single_core(streamingOut, scale, input);
+            }, 20);
+
+        for (int64_t y = 0; y < shape[0]; y += 97)
+            for (int64_t x = 0; x < shape[1]; x += 13)
+                REQUIRE(outputStreaming[symd::Dimensions({ y, x })] == output[symd::Dimensions({ y, x })]);
+
+        std::cout << "Scale float (64 MB -> 64 MB) - regular stores   : " << durationRegular.count() << " ms" << std::endl;
+        std::cout << "Scale float (64 MB -> 64 MB) - streaming stores : " << durationStreaming.count() << " ms" << std::endl;
+    }
+}
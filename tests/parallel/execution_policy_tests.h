@@ -0,0 +1,127 @@
+#pragma once
+#include "../test_helpers.h"
+
+
+namespace tests
+{
+    TEST_CASE("Execution policy - all backends give same result")
+    {
+        int64_t width = 640;
+        int64_t height = 480;
+
+        std::vector<float> input(width * height);
+        helpers::randomize_data(input);
+
+        auto input_2d = symd::views::data_view_2d(input.data(), width, height, width);
+        auto reference = helpers::apply_unary_op_to_vector<float>(input, [](auto x) { return x * 3.0f - 1.0f; });
+
+        auto policy = GENERATE(
+            symd::single_core_policy(),
+            symd::execution_policy(),
+            symd::execution_policy().with_backend(symd::Backend::thread_pool).with_num_threads(4).with_min_region_size(1000),
+            symd::execution_policy().with_num_threads(3).with_min_region_size(10).with_pinned_threads()
+        );
+
+        std::vector<float> output(input.size());
+        auto output_2d = symd::views::data_view_2d(output.data(), width, height, width);
+
+        symd::map(policy, output_2d, [](auto x) { return x * 3.0f - 1.0f; }, input_2d);
+
+        helpers::require_equal(output, reference);
+    }
+
+    TEST_CASE("Execution policy - unavailable backend throws")
+    {
+        std::vector<float> input(1000);
+        std::vector<float> output(input.size());
+
+        auto kernel = [](auto x) { return x + 1.0f; };
+
+#ifndef SYMD_USE_TBB
+        REQUIRE_THROWS_AS(symd::map(symd::execution_policy().with_backend(symd::Backend::tbb), output, kernel, input), std::invalid_argument);
+#endif
+
+#ifndef SYMD_HAS_STD_EXECUTION
+        REQUIRE_THROWS_AS(symd::map(symd::execution_policy().with_backend(symd::Backend::std_execution), output, kernel, input), std::invalid_argument);
+#endif
+
+        // std::execution can not be limited to number of threads and pins nothing
+        auto stdExecution = symd::execution_policy().with_backend(symd::Backend::std_execution);
+
+        REQUIRE_THROWS_AS(symd::map(stdExecution.with_num_threads(2), output, kernel, input), std::invalid_argument);
+        REQUIRE_THROWS_AS(symd::map(stdExecution.with_pinned_threads(), output, kernel, input), std::invalid_argument);
+
+        // Automatic backend falls back to thread pool for pinned threads
+        symd::map(symd::execution_policy().with_pinned_threads().with_num_threads(2).with_min_region_size(100), output, kernel, input);
+        helpers::require_equal(output, std::vector<float>(input.size(), 1.0f));
+    }
+
+    TEST_CASE("Execution policy - invalid unroll throws")
+    {
+        std::vector<float> input(1000);
+        std::vector<float> output(input.size());
+
+        auto kernel = [](auto x) { return x + 1.0f; };
+
+        for (int unroll : { 0, 3, 5, 8, -1 })
+        {
+            REQUIRE_THROWS_AS(symd::execution_policy().with_unroll(unroll), std::invalid_argument);
+
+            // Field set directly is rejected by map
+            auto policy = symd::execution_policy();
+            policy.unroll = unroll;
+
+            REQUIRE_THROWS_AS(symd::map(policy, output, kernel, input), std::invalid_argument);
+            REQUIRE_THROWS_AS(symd::map_single_core(policy, output, kernel, input), std::invalid_argument);
+        }
+
+        for (int unroll : { 1, 2, 4 })
+        {
+            symd::map_single_core(symd::execution_policy().with_unroll(unroll), output, kernel, input);
+            helpers::require_equal(output, std::vector<float>(input.size(), 1.0f));
+        }
+    }
+
+    TEST_CASE("Execution policy - invalid min region size throws")
+    {
+        std::vector<float> input(1000);
+        std::vector<float> output(input.size());
+
+        auto kernel = [](auto x) { return x + 1.0f; };
+
+        for (int64_t minRegionSize : { 0, -1, -100000 })
+        {
+            REQUIRE_THROWS_AS(symd::execution_policy().with_min_region_size(minRegionSize), std::invalid_argument);
+
+            // Field set directly is rejected by map
+            auto policy = symd::execution_policy();
+            policy.min_region_size = minRegionSize;
+
+            REQUIRE_THROWS_AS(symd::map(policy, output, kernel, input), std::invalid_argument);
+        }
+
+        symd::map(symd::execution_policy().with_min_region_size(1), output, kernel, input);
+        helpers::require_equal(output, std::vector<float>(input.size(), 1.0f));
+    }
+
+    TEST_CASE("Execution policy - reduction with fine grained regions")
+    {
+        std::vector<int> input(100000);
+        helpers::randomize_data(input);
+
+        auto sum = symd::views::reduce_view(symd::Dimensions({ (int64_t)input.size() }), 0, [](auto x, auto y)
+            {
+                return x + y;
+            });
+
+        auto policy = symd::execution_policy().with_num_threads(4).with_min_region_size(1024);
+        symd::map(policy, sum, [](auto x) { return x; }, input);
+
+        int resLoop = 0;
+
+        for (auto x : input)
+            resLoop += x;
+
+        REQUIRE(sum.getResult() == resLoop);
+    }
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include "../test_helpers.h"
+#include "../../LibSymd/internal/thread_pool.h"
+
+
+namespace tests
+{
+    TEST_CASE("Thread pool - every index executed once")
+    {
+        symd::__internal__::ThreadPool pool(3);
+        REQUIRE(pool.num_threads() == 4);
+
+        std::vector<std::atomic<int>> counters(1000);
+
+        for (int iter = 0; iter < 10; iter++)
+        {
+            pool.parallel_for(counters.size(), [&](size_t i)
+                {
+                    counters[i]++;
+                });
+        }
+
+        for (auto& counter : counters)
+            REQUIRE(counter == 10);
+    }
+
+    TEST_CASE("Thread pool - exception is rethrown on caller")
+    {
+        symd::__internal__::ThreadPool pool(2);
+
+        REQUIRE_THROWS_AS(pool.parallel_for(100, [](size_t i)
+            {
+                if (i == 42)
+                    throw std::runtime_error("Failed");
+            }), std::runtime_error);
+
+        // Pool is still usable after exception
+        std::atomic<int> sum = 0;
+        pool.parallel_for(100, [&](size_t i) { sum += (int)i; });
+
+        REQUIRE(sum == 4950);
+    }
+
+    TEST_CASE("Thread pool - pinned pools do not share cores")
+    {
+        symd::__internal__::ThreadPool first(2, true);
+        symd::__internal__::ThreadPool second(2, true);
+        symd::__internal__::ThreadPool notPinned(2);
+
+        REQUIRE(first.pinned_cores().size() == 2);
+        REQUIRE(second.pinned_cores().size() == 2);
+        REQUIRE(notPinned.pinned_cores().empty());
+
+        size_t numCores = std::max(1u, std::thread::hardware_concurrency());
+
+        for (size_t core : first.pinned_cores())
+        {
+            REQUIRE(core < numCores);
+
+            // Core 0 is left for calling thread, cores are shared only when there are not enough of them
+            if (numCores > 4)
+            {
+                REQUIRE(core != 0);
+                REQUIRE(std::find(second.pinned_cores().begin(), second.pinned_cores().end(), core) == second.pinned_cores().end());
+            }
+        }
+    }
+
+    TEST_CASE("Thread pool - multi core map on 2d data")
+    {
+        int64_t width = 1920;
+        int64_t height = 1080;
+
+        std::vector<float> input(width * height);
+        helpers::randomize_data(input);
+
+        std::vector<float> output(input.size());
+
+        auto input_2d = symd::views::data_view_2d(input.data(), width, height, width);
+        auto output_2d = symd::views::data_view_2d(output.data(), width, height, width);
+
+        symd::map(output_2d, [](auto x) { return x * 2.0f + 1.0f; }, input_2d);
+
+        auto reference = helpers::apply_unary_op_to_vector<float>(input, [](auto x) { return x * 2.0f + 1.0f; });
+        helpers::require_equal(output, reference);
+    }
+}
@@ -26,6 +26,45 @@ namespace tests
         REQUIRE(res ==  342);
     }
 
+    TEST_CASE("Reduction - partial vector tail")
+    {
+        // Tail lanes must be filled with start value, not with zeros.
+        std::vector<float> input(13, 2.0f);
+        auto prod = symd::views::reduce_view(symd::Dimensions({ 13 }), 1.0f, [](auto x, auto y) { return x * y; });
+
+        symd::map_single_core(prod, [](auto x) { return x; }, input);
+
+        REQUIRE(prod.getResult() == 8192.0f);
+    }
+
+    TEMPLATE_TEST_CASE("Reduction - built-in operations", "", float, int, double)
+    {
+        std::vector<TestType> input(1003);
+
+        for (size_t i = 0; i < input.size(); i++)
+            input[i] = (TestType)((i * 37) % 101) - (TestType)50;
+
+        auto shape = symd::Dimensions({ (int64_t)input.size() });
+
+        auto sum = symd::views::reduce_view(shape, (TestType)0, symd::views::reduce_sum());
+        auto mn = symd::views::reduce_view(shape, (TestType)1000, symd::views::reduce_min());
+        auto mx = symd::views::reduce_view(shape, (TestType)-1000, symd::views::reduce_max());
+
+        symd::map_single_core(sum, [](auto x) { return x; }, input);
+        symd::map_single_core(mn, [](auto x) { return x; }, input);
+        symd::map_single_core(mx, [](auto x) { return x; }, input);
+
+        // Integer valued inputs keep float sum exact
+        TestType refSum = 0;
+
+        for (auto x : input)
+            refSum += x;
+
+        REQUIRE(sum.getResult() == refSum);
+        REQUIRE(mn.getResult() == *std::min_element(input.begin(), input.end()));
+        REQUIRE(mx.getResult() == *std::max_element(input.begin(), input.end()));
+    }
+
     TEST_CASE("Reduction - many elements - int")
     {
         int64_t width = 1920;
@@ -132,4 +171,98 @@ namespace tests
 
         REQUIRE(resY == 2 * resX);
     }
+
+    TEST_CASE("Reduction - parallel float sum is reproducible")
+    {
+        std::vector<float> input(1000003);
+        helpers::randomize_data(input);
+
+        auto parallelSum = [&](int numThreads)
+        {
+            auto sum = symd::views::reduce_view(symd::Dimensions({ (int64_t)input.size() }), 0.0f, [](auto x, auto y)
+                {
+                    return x + y;
+                });
+
+            symd::map(symd::execution_policy().with_num_threads(numThreads).with_min_region_size(10000), sum, [](auto x) { return x; }, input);
+
+            return sum.getResult();
+        };
+
+        double reference = std::accumulate(input.begin(), input.end(), 0.0);
+        float first = parallelSum(4);
+
+        REQUIRE(std::abs(first - reference) / reference < 1e-5);
+
+        // Region results are combined in same order regardless of thread count and timing.
+        for (int i = 0; i < 20; i++)
+            REQUIRE(parallelSum(1 + i % 8) == first);
+    }
+
+    TEST_CASE("Reduction - along axes")
+    {
+        int64_t width = 1923;
+        int64_t height = 517;
+        auto shape = symd::Dimensions({ height, width });
+
+        std::vector<int> input(width * height);
+        helpers::randomize_data(input);
+
+        auto input_2d = symd::views::data_view_2d(input.data(), width, height, width);
+
+        std::vector<int> rowSumsRef(height, 0);
+        std::vector<int> colMaxRef(width, 0);
+
+        for (int64_t r = 0; r < height; r++)
+        {
+            for (int64_t c = 0; c < width; c++)
+            {
+                rowSumsRef[r] += input[r * width + c];
+                colMaxRef[c] = std::max(colMaxRef[c], input[r * width + c]);
+            }
+        }
+
+        // Last axis reduced - register accumulators reduced horizontally at the end of every row
+        std::vector<int> rowSums(height);
+        auto rowSumsView = symd::views::axis_reduce_view(shape, { 1 }, symd::views::data_view_2d(rowSums.data(), 1, height, 1), 0,
+            [](auto x, auto y) { return x + y; });
+
+        symd::map(rowSumsView, [](auto x) { return x; }, input_2d);
+        helpers::require_equal(rowSums, rowSumsRef);
+
+        // First axis reduced - input rows accumulate to output row, parallel regions split columns only
+        std::vector<int> colMax(width);
+        auto colMaxView = symd::views::axis_reduce_view(shape, { 0 }, symd::views::data_view_2d(colMax.data(), width, 1, width), 0,
+            [](auto x, auto y) { return std::max(x, y); });
+
+        symd::map(symd::execution_policy().with_min_region_size(1000), colMaxView, [](auto x) { return x; }, input_2d);
+        helpers::require_equal(colMax, colMaxRef);
+    }
+
+    TEST_CASE("Reduction - along axes - per channel sums")
+    {
+        // (height, width, channels) image with channels in last dimension, sum over height and width
+        int64_t height = 33;
+        int64_t width = 41;
+        int64_t channels = 24;
+        auto shape = symd::Dimensions({ height, width, channels });
+
+        std::vector<float> input(height * width * channels);
+        helpers::randomize_data(input);
+
+        std::vector<float> sumsRef(channels, 0.0f);
+
+        for (size_t i = 0; i < input.size(); i++)
+            sumsRef[i % channels] += input[i];
+
+        std::vector<float> sums(channels);
+        auto sumsView = symd::views::axis_reduce_view(shape, { 0, 1 }, 
+            symd::views::data_view<float, 3>(sums.data(), symd::Dimensions({ 1, 1, channels }), symd::Dimensions({ channels, channels, 1 })), 0.0f,
+            [](auto x, auto y) { return x + y; });
+
+        auto input_3d = symd::views::data_view<float, 3>(input.data(), shape, shape.native_pitch());
+        symd::map(sumsView, [](auto x) { return x; }, input_3d);
+
+        helpers::require_near(sums, sumsRef, 0.5f);
+    }
 }
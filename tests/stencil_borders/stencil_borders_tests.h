@@ -89,4 +89,65 @@ namespace tests
         // Verify
         helpers::require_near(output, expected_output, 0.03f);
     }*/
-}
\ No newline at end of file
+
+    TEST_CASE("Stencil - sub view border")
+    {
+        std::vector<float> input(100 * 50);
+        auto input_2d = symd::views::data_view_2d(input.data(), 50, 100, 50);
+        auto st = symd::views::stencil(input_2d, symd::Dimensions({ 2, 2 }));
+
+        using symd::__internal__::Region;
+
+        // Inside of the image neighbours are read from memory, no border handling needed
+        auto inner = symd::__internal__::getBorder(symd::__internal__::sub_view(st, Region(symd::Dimensions({ 10, 10 }), symd::Dimensions({ 20, 30 }))));
+        REQUIRE(inner[0] == 0);
+        REQUIRE(inner[1] == 0);
+
+        // Touching top edge and one element away from right edge
+        auto edge = symd::__internal__::getBorder(symd::__internal__::sub_view(st, Region(symd::Dimensions({ 0, 10 }), symd::Dimensions({ 20, 48 }))));
+        REQUIRE(edge[0] == 2);
+        REQUIRE(edge[1] == 1);
+    }
+
+    TEST_CASE("Stencil - vectorized borders match scalar border handling")
+    {
+        auto border = GENERATE(symd::Border::constant, symd::Border::replicate, symd::Border::mirror, symd::Border::mirror_replicate);
+        auto [width, height] = GENERATE(std::pair<int64_t, int64_t>{ 67, 45 }, std::pair<int64_t, int64_t>{ 5, 4 });
+
+        INFO("Border: " << (int)border << ", size: " << width << "x" << height);
+
+        std::vector<float> input(width * height);
+
+        for (size_t i = 0; i < input.size(); i++)
+            input[i] = (float)((i * 37) % 251);
+
+        auto input_2d = symd::views::data_view_2d(input.data(), width, height, width);
+        auto st = symd::views::stencil(input_2d, symd::Dimensions({ 3, 3 }), border, 7);
+
+        // Every tap has different weight, so reading wrong neighbour changes the result
+        auto conv7x7 = [](const auto& x)
+        {
+            auto sum = x(-3, -3) * 0.0f;
+
+            for (int i = -3; i <= 3; i++)
+                for (int j = -3; j <= 3; j++)
+                    sum += x(i, j) * (float)((i + 3) * 7 + j + 4);
+
+            return sum;
+        };
+
+        std::vector<float> output(input.size());
+        auto output_2d = symd::views::data_view_2d(output.data(), width, height, width);
+
+        symd::map_single_core(output_2d, conv7x7, st);
+
+        // Scalar border handling through coordinates is the reference
+        std::vector<float> reference(input.size());
+
+        for (int64_t r = 0; r < height; r++)
+            for (int64_t c = 0; c < width; c++)
+                reference[r * width + c] = conv7x7(symd::__internal__::fetchData(st, symd::Dimensions({ r, c })));
+
+        helpers::require_equal(output, reference);
+    }
+}
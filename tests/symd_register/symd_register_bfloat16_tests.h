@@ -6,13 +6,13 @@ namespace tests
 {
     TEST_CASE("SymdRegister bfloat16 load and store 1")
     {
-        std::vector<symd::bfloat16> in_data = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f };
+        auto in_data = helpers::repeat_to_symd_len(std::vector<symd::bfloat16>{ 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f });
         symd::__internal__::SymdRegister<symd::bfloat16> reg(in_data.data());
 
         for (int i = 0; i < symd::__internal__::SYMD_LEN; i++)
             REQUIRE((float)reg[i] == (float)in_data[i]);
 
-        std::vector<symd::bfloat16> out_data = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+        std::vector<symd::bfloat16> out_data(symd::__internal__::SYMD_LEN, 0.0f);
         reg.store(out_data.data());
 
         for (int i = 0; i < symd::__internal__::SYMD_LEN; i++)
@@ -34,10 +34,11 @@ namespace tests
         helpers::check_binary_op_result(inData1, std::plus(), inData2);
         helpers::check_binary_op_result(inData2, std::plus(), inData1);
 
-        SymdRegister<TestType> reg1(inData1.data());
+        const auto reg1Data = helpers::repeat_to_symd_len(inData1);
+        SymdRegister<TestType> reg1(reg1Data.data());
         SymdRegister<TestType> res;
 
-        auto reg1Plus10 = helpers::apply_binary_op_to_vector(inData1, std::plus(), (TestType)10.0);
+        auto reg1Plus10 = helpers::apply_binary_op_to_vector(reg1Data, std::plus(), (TestType)10.0);
 
         res = reg1 + 10;
         helpers::require_equal(res, reg1Plus10);
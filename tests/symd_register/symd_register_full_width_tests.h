@@ -0,0 +1,273 @@
+#pragma once
+#include "../test_helpers.h"
+
+
+namespace tests
+{
+    /////////////////////////////////////////////////////////////////////////////////////////
+    /// Test full width unsigned char registers
+    /////////////////////////////////////////////////////////////////////////////////////////
+
+    constexpr int FULL_LEN = symd::__internal__::symd_len<unsigned char>;
+
+    static std::vector<unsigned char> fullWidthTestData(int seed)
+    {
+        std::vector<unsigned char> data(FULL_LEN);
+
+        for (int i = 0; i < FULL_LEN; i++)
+            data[i] = (unsigned char)((i * 37 + seed * 101) % 256);
+
+        return data;
+    }
+
+    TEST_CASE("Full width register uses all bytes of register")
+    {
+        REQUIRE(FULL_LEN * sizeof(unsigned char) == sizeof(FullWidthRegister<unsigned char>));
+        REQUIRE(FULL_LEN == symd::__internal__::FULL_WIDTH_PARTS * symd::__internal__::SYMD_LEN);
+    }
+
+    TEST_CASE("Full width register partial load and store")
+    {
+        auto in_data = fullWidthTestData(1);
+
+        for (int count = 0; count <= FULL_LEN; count++)
+        {
+            FullWidthRegister<unsigned char> reg(in_data.data(), count);
+
+            for (int i = 0; i < FULL_LEN; i++)
+                REQUIRE(reg[i] == (i < count ? in_data[i] : 0));
+
+            std::vector<unsigned char> out_data(FULL_LEN, 100);
+            reg.store(out_data.data(), count);
+
+            for (int i = 0; i < FULL_LEN; i++)
+                REQUIRE(out_data[i] == (i < count ? in_data[i] : 100));
+        }
+    }
+
+    TEST_CASE("Full width register operations")
+    {
+        auto a = fullWidthTestData(1);
+        auto b = fullWidthTestData(2);
+        b[3] = a[3];
+
+        FullWidthRegister<unsigned char> ra(a.data());
+        FullWidthRegister<unsigned char> rb(b.data());
+
+        auto sum = ra + rb;
+        auto diff = ra - rb;
+        auto average = symd::kernel::avg(ra, rb);
+        auto mn = std::min(ra, rb);
+        auto mx = std::max(ra, rb);
+        auto bitAnd = ra & rb;
+        auto bitOr = ra | rb;
+        auto bitXor = ra ^ rb;
+        auto bitNot = ~ra;
+        auto eq = ra == rb;
+        auto neq = ra != rb;
+        auto blended = symd::kernel::blend(eq, ra, (unsigned char)7);
+
+        for (int i = 0; i < FULL_LEN; i++)
+        {
+            REQUIRE(sum[i] == std::min(a[i] + b[i], 255));
+            REQUIRE(diff[i] == std::max(a[i] - b[i], 0));
+            REQUIRE(average[i] == (a[i] + b[i] + 1) / 2);
+            REQUIRE(mn[i] == std::min(a[i], b[i]));
+            REQUIRE(mx[i] == std::max(a[i], b[i]));
+            REQUIRE(bitAnd[i] == (a[i] & b[i]));
+            REQUIRE(bitOr[i] == (a[i] | b[i]));
+            REQUIRE(bitXor[i] == (a[i] ^ b[i]));
+            REQUIRE(bitNot[i] == (unsigned char)~a[i]);
+            REQUIRE(eq[i] == (a[i] == b[i] ? 255 : 0));
+            REQUIRE(neq[i] == (a[i] != b[i] ? 255 : 0));
+            REQUIRE(blended[i] == (a[i] == b[i] ? a[i] : 7));
+        }
+    }
+
+    TEST_CASE("Full width register horizontal reductions")
+    {
+        auto a = fullWidthTestData(3);
+        FullWidthRegister<unsigned char> reg(a.data());
+
+        unsigned char sum = 0;
+        unsigned char andRes = a[0];
+        unsigned char orRes = a[0];
+
+        for (auto x : a)
+        {
+            sum = (unsigned char)(sum + x);
+            andRes &= x;
+            orRes |= x;
+        }
+
+        REQUIRE(symd::kernel::hsum(reg) == sum);
+        REQUIRE(symd::kernel::hmin(reg) == *std::min_element(a.begin(), a.end()));
+        REQUIRE(symd::kernel::hmax(reg) == *std::max_element(a.begin(), a.end()));
+        REQUIRE(symd::kernel::hand(reg) == andRes);
+        REQUIRE(symd::kernel::hor(reg) == orRes);
+    }
+
+    TEST_CASE("Full width register conversions give register packs")
+    {
+        auto a = fullWidthTestData(4);
+        FullWidthRegister<unsigned char> reg(a.data());
+
+        auto asFloat = symd::kernel::convert_to<float>(reg);
+        auto asInt = symd::kernel::convert_to<int>(reg);
+
+        static_assert(std::is_same_v<decltype(asFloat), RegisterPack<float, symd::__internal__::FULL_WIDTH_PARTS>>);
+
+        // Values out of range saturate when converting back
+        auto scaled = symd::kernel::convert_to<unsigned char>(asInt * 3 - 100);
+        auto halved = symd::kernel::convert_to<unsigned char>(std::min(asFloat * 2.0f, 200.0f));
+
+        static_assert(std::is_same_v<decltype(scaled), FullWidthRegister<unsigned char>>);
+
+        for (int i = 0; i < FULL_LEN; i++)
+        {
+            REQUIRE(asFloat[i] == (float)a[i]);
+            REQUIRE(asInt[i] == (int)a[i]);
+            REQUIRE(scaled[i] == std::clamp(a[i] * 3 - 100, 0, 255));
+            REQUIRE(halved[i] == std::min(a[i] * 2, 200));
+        }
+
+        REQUIRE(symd::kernel::hsum(asInt) == std::accumulate(a.begin(), a.end(), 0));
+    }
+
+    TEST_CASE("Mapping unsigned char in full width registers")
+    {
+        for (int64_t width : { 1, 31, 32, 33, 64, 100, 1000 })
+        {
+            std::vector<unsigned char> input1(width * 3);
+            std::vector<unsigned char> input2(width * 3);
+
+            for (size_t i = 0; i < input1.size(); i++)
+            {
+                input1[i] = (unsigned char)(i * 13);
+                input2[i] = (unsigned char)(i * 7 + 5);
+            }
+
+            // Padding after last row must stay untouched
+            std::vector<unsigned char> output(width * 3 + 8, 1);
+
+            auto shape = symd::Dimensions({ 3, width });
+            auto in1 = symd::views::data_view<unsigned char, 2>(input1.data(), shape, shape.native_pitch());
+            auto in2 = symd::views::data_view<unsigned char, 2>(input2.data(), shape, shape.native_pitch());
+            auto out = symd::views::full_width(symd::views::data_view<unsigned char, 2>(output.data(), shape, shape.native_pitch()));
+
+            auto kernel = [](auto x, auto y)
+            {
+                // Integer arithmetic in wider type, converted back with saturation
+                auto weighted = symd::kernel::convert_to<int>(x) * 2 - symd::kernel::convert_to<int>(y);
+                auto res = symd::kernel::convert_to<unsigned char>(weighted);
+
+                return symd::kernel::blend(x == y, x, res);
+            };
+
+            symd::map(out, kernel, in1, in2);
+
+            for (int64_t i = 0; i < width * 3; i++)
+            {
+                auto expected = input1[i] == input2[i] ? input1[i] : std::clamp(input1[i] * 2 - input2[i], 0, 255);
+                REQUIRE(output[i] == expected);
+            }
+
+            for (int64_t i = width * 3; i < (int64_t)output.size(); i++)
+                REQUIRE(output[i] == 1);
+        }
+    }
+
+    TEST_CASE("Mapping unsigned char with float math")
+    {
+        std::vector<unsigned char> input(1000);
+
+        for (size_t i = 0; i < input.size(); i++)
+            input[i] = (unsigned char)(i * 31);
+
+        std::vector<unsigned char> output(input.size());
+        auto out = symd::views::full_width(output);
+
+        // Float kernels work on register packs the same way as on registers
+        symd::map(out, [](auto x)
+            {
+                auto f = symd::kernel::convert_to<float>(x);
+                auto res = symd::kernel::fma(f, 0.5f, symd::kernel::sigmoid(f - 128.0f) * 100.0f);
+                return symd::kernel::convert_to<unsigned char>(res);
+            }, input);
+
+        for (size_t i = 0; i < input.size(); i++)
+        {
+            float f = input[i];
+            float expected = f * 0.5f + 100.0f / (1.0f + std::exp(128.0f - f));
+            REQUIRE(std::abs(output[i] - expected) <= 1.0f);
+        }
+    }
+
+    TEST_CASE("Mapping unsigned char - full width vs narrow registers speed")
+    {
+        std::vector<unsigned char> input1(1920 * 1080);
+        std::vector<unsigned char> input2(input1.size());
+        std::vector<unsigned char> output(input1.size());
+
+        for (size_t i = 0; i < input1.size(); i++)
+        {
+            input1[i] = (unsigned char)(i * 13);
+            input2[i] = (unsigned char)(i * 7);
+        }
+
+        // Output of int view is not unsigned char, so this map takes SymdRegister path
+        std::vector<int> outputInt(input1.size());
+        auto out = symd::views::full_width(output);
+
+        auto durationFull = helpers::measure_execution_time_ms([&]()
+            {
+                symd::map_single_core(out, [](auto x, auto y) { return symd::kernel::avg(x, y); }, input1, input2);
+            }, 100);
+
+        auto durationNarrow = helpers::measure_execution_time_ms([&]()
+            {
+                symd::map_single_core(outputInt, [](auto x, auto y)
+                    {
+                        return symd::kernel::convert_to<int>(symd::kernel::avg(x, y));
+                    }, input1, input2);
+            }, 100);
+
+        for (size_t i = 0; i < input1.size(); i++)
+            REQUIRE(output[i] == outputInt[i]);
+
+        std::cout << "Map avg (unsigned char) - full width registers : " << durationFull.count() << " ms" << std::endl;
+        std::cout << "Map avg (unsigned char) - SymdRegister -> int   : " << durationNarrow.count() << " ms" << std::endl;
+    }
+
+    TEST_CASE("Mapping unsigned char without full width view uses SymdRegister")
+    {
+        std::vector<unsigned char> input(1000);
+
+        for (size_t i = 0; i < input.size(); i++)
+            input[i] = (unsigned char)(i * 31);
+
+        std::vector<unsigned char> output(input.size());
+        std::vector<unsigned char> outputFull(input.size());
+
+        // Kernels written for SymdRegister only keep compiling for plain unsigned char maps
+        auto kernel = [](auto x)
+        {
+            auto f = symd::kernel::convert_to<float>(x) + 1.0f;
+            return symd::kernel::convert_to<unsigned char>(symd::kernel::convert_to<float>(symd::kernel::fp_exp(f)) * 10.0f);
+        };
+
+        symd::map_single_core(output, kernel, input);
+
+        for (size_t i = 0; i < input.size(); i++)
+            REQUIRE(output[i] == symd::kernel::convert_to<unsigned char>((float)symd::kernel::fp_exp(input[i] + 1.0f) * 10.0f));
+
+        // Full width streaming output, wrappers compose
+        symd::Tensor<unsigned char> tensorOutput(symd::Dimensions({ (int64_t)input.size() }));
+        auto fullStreaming = symd::views::full_width(symd::views::streaming(tensorOutput));
+
+        symd::map(fullStreaming, [](auto x) { return x + x; }, input);
+
+        for (size_t i = 0; i < input.size(); i++)
+            REQUIRE(tensorOutput[symd::Dimensions({ (int64_t)i })] == std::min(2 * input[i], 255));
+    }
+}
@@ -14,6 +14,13 @@ namespace tests
     static std::vector<unsigned char> inData1b{ 1, 2, 3, 4, 4, 6, 7, 8 };
     static std::vector<unsigned char> inData2b{ 8, 7, 6, 4, 4, 3, 2, 1 };
 
+    static std::vector<int16_t> inData1s{ 1, -2, 3, 4, 4, -6, 7, 30000 };
+    static std::vector<int16_t> inData2s{ 8, 7, -6, 4, 4, 3, -2, 30000 };
+
+    // Values above 0x8000 check that unsigned lanes are not compared as signed
+    static std::vector<uint16_t> inData1us{ 1, 40000, 3, 4, 4, 6, 65535, 8 };
+    static std::vector<uint16_t> inData2us{ 8, 7, 50000, 4, 4, 3, 2, 65535 };
+
     template <typename IT>
     std::pair<const std::vector<IT>, const std::vector<IT>> getIntTestData()
     {
@@ -21,13 +28,21 @@ namespace tests
         {
             return std::make_pair(inData1i, inData2i);
         }
+        else if constexpr (std::is_same_v<IT, int16_t>)
+        {
+            return std::make_pair(inData1s, inData2s);
+        }
+        else if constexpr (std::is_same_v<IT, uint16_t>)
+        {
+            return std::make_pair(inData1us, inData2us);
+        }
         else
         {
             return std::make_pair(inData1b, inData2b);
         }
     }
 
-    TEMPLATE_TEST_CASE("Int addition", "[integer][operators]", int)
+    TEMPLATE_TEST_CASE("Int addition", "[integer][operators]", int, int16_t, uint16_t)
     {
         const auto [inData1, inData2] = getIntTestData<TestType>();
         helpers::check_binary_op_result(inData1, std::plus(), inData2);
@@ -35,7 +50,7 @@ namespace tests
     }
 
 
-    TEMPLATE_TEST_CASE("Int substraction", "[integer][operators]", int)
+    TEMPLATE_TEST_CASE("Int substraction", "[integer][operators]", int, int16_t, uint16_t)
     {
         const auto [inData1, inData2] = getIntTestData<TestType>();
 
@@ -44,7 +59,7 @@ namespace tests
     }
 
 
-    TEMPLATE_TEST_CASE("Int multiplication", "[integer][operators]", int)
+    TEMPLATE_TEST_CASE("Int multiplication", "[integer][operators]", int, int16_t, uint16_t)
     {
         const auto [inData1, inData2] = getIntTestData<TestType>();
 
@@ -53,13 +68,13 @@ namespace tests
     }
 
 
-    TEMPLATE_TEST_CASE("Int division", "[integer][operators]", int, unsigned char)
+    TEMPLATE_TEST_CASE("Int division", "[integer][operators]", int, unsigned char, int16_t, uint16_t)
     {
         // Division not supported for int. Convert to other type
         //helpers::check_binary_op_result(inData1, std::divides(), inData2);
     }
 
-    TEMPLATE_TEST_CASE("Int bit and", "[integer][operators]", int, unsigned char)
+    TEMPLATE_TEST_CASE("Int bit and", "[integer][operators]", int, unsigned char, int16_t, uint16_t)
     {
         const auto [inData1, inData2] = getIntTestData<TestType>();
 
@@ -68,7 +83,7 @@ namespace tests
     }
 
 
-    TEMPLATE_TEST_CASE("Int bit or", "[integer][operators]", int, unsigned char)
+    TEMPLATE_TEST_CASE("Int bit or", "[integer][operators]", int, unsigned char, int16_t, uint16_t)
     {
         const auto [inData1, inData2] = getIntTestData<TestType>();
 
@@ -77,7 +92,7 @@ namespace tests
     }
 
 
-    TEMPLATE_TEST_CASE("Int bit xor", "[integer][operators]", int, unsigned char)
+    TEMPLATE_TEST_CASE("Int bit xor", "[integer][operators]", int, unsigned char, int16_t, uint16_t)
     {
         const auto [inData1, inData2] = getIntTestData<TestType>();
 
@@ -86,7 +101,7 @@ namespace tests
     }
 
 
-    TEMPLATE_TEST_CASE("Int bit not", "[integer][operators]", int, unsigned char)
+    TEMPLATE_TEST_CASE("Int bit not", "[integer][operators]", int, unsigned char, int16_t, uint16_t)
     {
         const auto [inData1, inData2] = getIntTestData<TestType>();
 
@@ -95,7 +110,7 @@ namespace tests
     }
 
 
-    TEMPLATE_TEST_CASE("Int cmp equal", "[integer][operators]", int)
+    TEMPLATE_TEST_CASE("Int cmp equal", "[integer][operators]", int, int16_t, uint16_t)
     {
         const auto [inData1, inData2] = getIntTestData<TestType>();
 
@@ -103,7 +118,7 @@ namespace tests
         helpers::check_cmp_op_result(inData2, std::equal_to(), inData1);
     }
 
-    TEMPLATE_TEST_CASE("Int cmp not equal", "[integer][operators]", int)
+    TEMPLATE_TEST_CASE("Int cmp not equal", "[integer][operators]", int, int16_t, uint16_t)
     {
         const auto [inData1, inData2] = getIntTestData<TestType>();
 
@@ -111,8 +126,22 @@ namespace tests
         helpers::check_cmp_op_result(inData2, std::not_equal_to(), inData1);
     }
 
+    TEMPLATE_TEST_CASE("Int cmp not equal as blend selector", "[integer][operators]", int, unsigned char, int16_t, uint16_t)
+    {
+        const auto [inData1, inData2] = getIntTestData<TestType>();
+
+        symd::__internal__::SymdRegister<TestType> reg1(inData1.data(), (int)inData1.size());
+        symd::__internal__::SymdRegister<TestType> reg2(inData2.data(), (int)inData2.size());
+
+        // Selector comes straight from comparison, as in kernels
+        auto res = symd::kernel::blend(reg1 != reg2, reg1 + reg1, reg2);
+
+        for (size_t i = 0; i < inData1.size(); i++)
+            REQUIRE(res[i] == (inData1[i] != inData2[i] ? (TestType)(inData1[i] + inData1[i]) : inData2[i]));
+    }
+
 
-    TEMPLATE_TEST_CASE("Int cmp greater equal", "[integer][operators]", int)
+    TEMPLATE_TEST_CASE("Int cmp greater equal", "[integer][operators]", int, int16_t, uint16_t)
     {
         const auto [inData1, inData2] = getIntTestData<TestType>();
 
@@ -120,7 +149,7 @@ namespace tests
         helpers::check_cmp_op_result(inData2, std::greater_equal(), inData1);
     }
 
-    TEMPLATE_TEST_CASE("Int cmp less equal", "[integer][operators]", int)
+    TEMPLATE_TEST_CASE("Int cmp less equal", "[integer][operators]", int, int16_t, uint16_t)
     {
         const auto [inData1, inData2] = getIntTestData<TestType>();
 
@@ -129,7 +158,7 @@ namespace tests
     }
 
 
-    TEMPLATE_TEST_CASE("Int cmp greater", "[integer][operators]", int)
+    TEMPLATE_TEST_CASE("Int cmp greater", "[integer][operators]", int, int16_t, uint16_t)
     {
         const auto [inData1, inData2] = getIntTestData<TestType>();
 
@@ -138,7 +167,7 @@ namespace tests
     }
 
 
-    TEMPLATE_TEST_CASE("Int cmp less", "[integer][operators]", int)
+    TEMPLATE_TEST_CASE("Int cmp less", "[integer][operators]", int, int16_t, uint16_t)
     {
         const auto [inData1, inData2] = getIntTestData<TestType>();
 
@@ -204,4 +233,189 @@ namespace tests
         helpers::check_binary_op_result(inData1b, ucMinusSat, inData2b);
         helpers::check_binary_op_result(inData2b, ucMinusSat, inData1b);
     }
-}
\ No newline at end of file
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////
+    /// Test 16 bit integer specific operations
+    /////////////////////////////////////////////////////////////////////////////////////////
+
+    TEMPLATE_TEST_CASE("16 bit int saturating addition and substraction", "[integer][operators]", int16_t, uint16_t)
+    {
+        const auto [inData1, inData2] = getIntTestData<TestType>();
+
+        auto saturate = [](int x)
+        {
+            return (TestType)std::clamp(x, (int)std::numeric_limits<TestType>::min(), (int)std::numeric_limits<TestType>::max());
+        };
+
+        auto addsOp = [&](auto&& lhs, auto&& rhs)
+        {
+            if constexpr (std::is_same_v<std::decay_t<decltype(lhs)>, TestType>)
+                return saturate((int)lhs + (int)rhs);
+            else
+                return lhs.adds(rhs);
+        };
+
+        auto subsOp = [&](auto&& lhs, auto&& rhs)
+        {
+            if constexpr (std::is_same_v<std::decay_t<decltype(lhs)>, TestType>)
+                return saturate((int)lhs - (int)rhs);
+            else
+                return lhs.subs(rhs);
+        };
+
+        helpers::check_binary_op_result(inData1, addsOp, inData2);
+        helpers::check_binary_op_result(inData2, addsOp, inData1);
+        helpers::check_binary_op_result(inData1, subsOp, inData2);
+        helpers::check_binary_op_result(inData2, subsOp, inData1);
+    }
+
+
+    TEMPLATE_TEST_CASE("16 bit int shifts", "[integer][operators]", int16_t, uint16_t)
+    {
+        const auto [inData1, inData2] = getIntTestData<TestType>();
+
+        // Right shift of int16_t keeps sign, uint16_t shifts in zeros
+        helpers::check_unary_op_result([](auto&& x) -> std::decay_t<decltype(x)> { return x >> 3; }, inData1);
+
+        // Left shift of negative scalar is undefined before C++20, so reference shifts it as unsigned
+        helpers::check_unary_op_result([](auto&& x) -> std::decay_t<decltype(x)>
+            {
+                using X = std::decay_t<decltype(x)>;
+
+                if constexpr (std::is_arithmetic_v<X>)
+                    return (X)((std::make_unsigned_t<X>)x << 3);
+                else
+                    return x << 3;
+            }, inData2);
+    }
+
+
+    TEMPLATE_TEST_CASE("16 bit int min max abs", "[integer][operators]", int16_t, uint16_t)
+    {
+        const auto [inData1, inData2] = getIntTestData<TestType>();
+
+        auto minOp = [](auto&& lhs, auto&& rhs) { return std::min(lhs, rhs); };
+        auto maxOp = [](auto&& lhs, auto&& rhs) { return std::max(lhs, rhs); };
+
+        helpers::check_binary_op_result(inData1, minOp, inData2);
+        helpers::check_binary_op_result(inData1, maxOp, inData2);
+        helpers::check_unary_op_result([](auto&& x) -> std::decay_t<decltype(x)> { return std::abs(x); }, inData1);
+    }
+
+
+    TEMPLATE_TEST_CASE("16 bit int conversions", "[integer][conversions]", int16_t, uint16_t)
+    {
+        const auto [inData1, inData2] = getIntTestData<TestType>();
+        auto in = helpers::repeat_to_symd_len(inData1);
+
+        symd::__internal__::SymdRegister<TestType> reg(in.data());
+
+        auto asInt = symd::kernel::convert_to<int>(reg);
+        auto asFloat = symd::kernel::convert_to<float>(reg);
+        auto asDouble = symd::kernel::convert_to<double>(reg);
+
+        // Values out of range saturate when converting back
+        auto scaled = symd::kernel::convert_to<TestType>(asInt * 3 - 70000);
+        auto fromFloat = symd::kernel::convert_to<TestType>(asFloat);
+        auto fromDouble = symd::kernel::convert_to<TestType>(asDouble);
+        auto fromUChar = symd::kernel::convert_to<TestType>(symd::kernel::convert_to<unsigned char>(reg));
+
+        for (int i = 0; i < symd::__internal__::SYMD_LEN; i++)
+        {
+            REQUIRE(asInt[i] == (int)in[i]);
+            REQUIRE(asFloat[i] == (float)in[i]);
+            REQUIRE(asDouble[i] == (double)in[i]);
+            REQUIRE(scaled[i] == symd::kernel::convert_to<TestType>((int)in[i] * 3 - 70000));
+            REQUIRE(fromFloat[i] == in[i]);
+            REQUIRE(fromDouble[i] == in[i]);
+            REQUIRE(fromUChar[i] == (TestType)symd::kernel::convert_to<unsigned char>(in[i]));
+        }
+    }
+
+
+    TEST_CASE("16 bit int map")
+    {
+        std::vector<uint16_t> input = { 1, 2, 3, 60000, 5, 6, 7, 8, 9, 10, 65535 };
+        std::vector<int16_t> output(input.size());
+
+        symd::map(output, [](const auto& x)
+            {
+                return symd::kernel::convert_to<int16_t>(x >> 1);
+            }, input);
+
+        helpers::require_equal(output, { 0, 1, 1, 30000, 2, 3, 3, 4, 4, 5, 32767 });
+    }
+
+
+    TEMPLATE_TEST_CASE("SymdRegister partial load and store", "[operators]", float, double, int, unsigned char, int16_t, uint16_t, symd::bfloat16)
+    {
+        std::vector<TestType> in_data(symd::__internal__::SYMD_LEN);
+        for (int i = 0; i < symd::__internal__::SYMD_LEN; i++)
+            in_data[i] = (TestType)(float)(i + 1);
+
+        for (int count = 0; count <= symd::__internal__::SYMD_LEN; count++)
+        {
+            symd::__internal__::SymdRegister<TestType> reg(in_data.data(), count);
+
+            // Lanes past count are zero
+            for (int i = 0; i < symd::__internal__::SYMD_LEN; i++)
+                REQUIRE((float)reg[i] == (i < count ? (float)in_data[i] : 0.0f));
+
+            // Memory past count is not touched
+            std::vector<TestType> out_data(symd::__internal__::SYMD_LEN, (TestType)100.0f);
+            reg.store(out_data.data(), count);
+
+            for (int i = 0; i < symd::__internal__::SYMD_LEN; i++)
+                REQUIRE((float)out_data[i] == (i < count ? (float)in_data[i] : 100.0f));
+        }
+    }
+
+    TEMPLATE_TEST_CASE("SymdRegister horizontal reductions", "[operators]", float, double, int, unsigned char, int16_t, uint16_t, symd::bfloat16)
+    {
+        // Small values keep sums and products exact in every type
+        std::vector<TestType> in_data(symd::__internal__::SYMD_LEN);
+        for (int i = 0; i < symd::__internal__::SYMD_LEN; i++)
+            in_data[i] = (TestType)(float)((i * 5) % 7 + 1);
+
+        in_data[3] = (TestType)1.0f;
+
+        float sum = 0;
+        float prod = 1;
+        float mn = 1000;
+        float mx = 0;
+
+        for (auto x : in_data)
+        {
+            sum += (float)x;
+            prod *= (float)x;
+            mn = std::min(mn, (float)x);
+            mx = std::max(mx, (float)x);
+        }
+
+        symd::__internal__::SymdRegister<TestType> reg(in_data.data());
+
+        REQUIRE((float)symd::kernel::hsum(reg) == (float)(TestType)sum);
+        REQUIRE((float)symd::kernel::hmin(reg) == mn);
+        REQUIRE((float)symd::kernel::hmax(reg) == mx);
+
+        // Product of 16 lanes does not fit in 8 and 16 bit integers or bfloat16 mantissa
+        if constexpr ((std::is_integral_v<TestType> && sizeof(TestType) >= 4) || std::is_floating_point_v<TestType>)
+            REQUIRE((float)symd::kernel::hprod(reg) == prod);
+
+        if constexpr (std::is_integral_v<TestType>)
+        {
+            TestType andRes = in_data[0];
+            TestType orRes = in_data[0];
+
+            for (auto x : in_data)
+            {
+                andRes &= x;
+                orRes |= x;
+            }
+
+            REQUIRE(symd::kernel::hand(reg) == andRes);
+            REQUIRE(symd::kernel::hor(reg) == orRes);
+        }
+    }
+}
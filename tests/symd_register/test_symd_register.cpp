@@ -4,3 +4,4 @@
 #include "symd_register_float_tests.h"
 #include "symd_register_int_tests.h"
 #include "symd_register_bfloat16_tests.h"
+#include "symd_register_full_width_tests.h"
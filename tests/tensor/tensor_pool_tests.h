@@ -0,0 +1,123 @@
+#pragma once
+#include "../test_helpers.h"
+
+namespace tests
+{
+    TEST_CASE("Tensor pool - aligned buffers")
+    {
+        symd::TensorPool pool;
+
+        auto buffer = pool.acquire<float, 2>(symd::Dimensions({ 3, 37 }));
+
+        REQUIRE((uintptr_t)buffer.data() % symd::Tensor<float>::ALIGNMENT == 0);
+        REQUIRE(buffer.shape()[0] == 3);
+        REQUIRE(buffer.shape()[1] == 37);
+        REQUIRE(buffer.pitch()[1] == 1);
+        REQUIRE((buffer.pitch()[0] * sizeof(float)) % symd::Tensor<float>::ALIGNMENT == 0);
+
+        // Whole buffer is writable, padding included
+        std::fill_n(buffer.data(), buffer.pitch()[0] * 3, 1.0f);
+    }
+
+    TEST_CASE("Tensor pool - buffers are recycled by size class")
+    {
+        symd::TensorPool pool;
+        float* first = nullptr;
+
+        {
+            auto buffer = pool.acquire<float, 2>(symd::Dimensions({ 10, 100 }));
+            first = buffer.data();
+        }
+
+        REQUIRE(pool.num_allocations() == 1);
+
+        {
+            // Same size class, different shape and type
+            auto buffer = pool.acquire<int, 2>(symd::Dimensions({ 9, 120 }));
+            REQUIRE((void*)buffer.data() == (void*)first);
+
+            // First block is in use, so new one is allocated
+            auto other = pool.acquire<float, 1>(symd::Dimensions({ 50 }));
+            REQUIRE((void*)other.data() != (void*)first);
+
+            // Moved buffer is released only once
+            auto moved = std::move(other);
+        }
+
+        REQUIRE(pool.num_allocations() == 2);
+
+        pool.clear();
+
+        auto buffer = pool.acquire<float, 2>(symd::Dimensions({ 10, 100 }));
+        REQUIRE(pool.num_allocations() == 3);
+    }
+
+    TEST_CASE("Tensor pool - pipeline does not allocate after first frame")
+    {
+        symd::TensorPool pool;
+        auto shape = symd::Dimensions({ 120, 161 });
+
+        symd::Tensor<float> input(shape);
+        symd::Tensor<float> output(shape);
+
+        for (int64_t y = 0; y < shape[0]; y++)
+            for (int64_t x = 0; x < shape[1]; x++)
+                input[symd::Dimensions({ y, x })] = (float)(y + x);
+
+        size_t allocationsAfterFirstFrame = 0;
+
+        for (int frame = 0; frame < 10; frame++)
+        {
+            auto stage1 = pool.acquire<float, 2>(shape);
+            auto stage2 = pool.acquire<float, 2>(shape);
+
+            symd::map(stage1, [](auto x) { return x * 2.0f; }, input);
+            symd::map(stage2, [](auto x, auto y) { return x + y; }, stage1, input);
+
+            {
+                // Temporary which lives only in part of frame
+                auto stage3 = pool.acquire<float, 2>(shape);
+
+                symd::map(stage3, [](auto x) { return x - 1.0f; }, stage2);
+                symd::map(output, [f = (float)frame](auto x) { return x + f; }, stage3);
+            }
+
+            for (int64_t y = 0; y < shape[0]; y++)
+                for (int64_t x = 0; x < shape[1]; x++)
+                    REQUIRE(output[symd::Dimensions({ y, x })] == (float)(y + x) * 3.0f - 1.0f + (float)frame);
+
+            if (frame == 0)
+                allocationsAfterFirstFrame = pool.num_allocations();
+        }
+
+        REQUIRE(allocationsAfterFirstFrame == 3);
+        REQUIRE(pool.num_allocations() == allocationsAfterFirstFrame);
+    }
+
+    TEST_CASE("Tensor pool - acquire from multiple threads")
+    {
+        symd::TensorPool pool;
+        std::atomic<int> numErrors{ 0 };
+
+        symd::__internal__::ThreadPool::instance().parallel_for(1000, [&](size_t i)
+            {
+                int64_t width = 1 + (int64_t)(i % 200);
+                auto buffer = pool.acquire<int, 1>(symd::Dimensions({ width }));
+
+                for (int64_t j = 0; j < width; j++)
+                    buffer.data()[j] = (int)i;
+
+                // Nobody else writes to buffer while it is acquired
+                for (int64_t j = 0; j < width; j++)
+                    if (buffer.data()[j] != (int)i)
+                        numErrors++;
+            });
+
+        REQUIRE(numErrors == 0);
+
+        // Every thread holds one buffer at a time, so pool needs at most one block per thread in each size class.
+        // Widths of 1 to 200 ints are padded to 64 byte rows and fall in 5 size classes (64 to 1024 bytes).
+        size_t numThreads = symd::__internal__::ThreadPool::instance().num_threads();
+        REQUIRE(pool.num_allocations() <= numThreads * 5);
+    }
+}
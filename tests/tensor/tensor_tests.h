@@ -0,0 +1,156 @@
+#pragma once
+#include "../test_helpers.h"
+
+namespace tests
+{
+    template <typename T>
+    static void require_tensor_layout(const symd::Tensor<T>& t)
+    {
+        auto shape = t.shape();
+
+        REQUIRE((uintptr_t)t.data() % symd::Tensor<T>::ALIGNMENT == 0);
+        REQUIRE(t.pitch()[-1] == 1);
+
+        if (shape.num_dims() > 1)
+        {
+            // Every row starts at 64 byte boundary
+            REQUIRE(t.pitch()[-2] >= shape[-1]);
+            REQUIRE((t.pitch()[-2] * sizeof(T)) % symd::Tensor<T>::ALIGNMENT == 0);
+            REQUIRE(t.pitch()[-2] % symd::__internal__::symd_len<T> == 0);
+        }
+
+        for (int i = shape.num_dims() - 3; i >= 0; i--)
+            REQUIRE(t.pitch()[i] == t.pitch()[i + 1] * shape[i + 1]);
+    }
+
+    TEST_CASE("Tensor - aligned and padded layout")
+    {
+        symd::Tensor<float> a(symd::Dimensions({ 3, 37 }));
+        symd::Tensor<double> b(symd::Dimensions({ 2, 3, 5 }));
+        symd::Tensor<unsigned char> c(symd::Dimensions({ 4, 64 }));
+        symd::Tensor<int> d(symd::Dimensions({ 10 }));
+
+        require_tensor_layout(a);
+        require_tensor_layout(b);
+        require_tensor_layout(c);
+        require_tensor_layout(d);
+
+        // Elements are zero initialized
+        for (int64_t y = 0; y < 3; y++)
+            for (int64_t x = 0; x < 37; x++)
+                REQUIRE(a[symd::Dimensions({ y, x })] == 0.0f);
+
+        a[symd::Dimensions({ 1, 2 })] = 5.0f;
+        REQUIRE(a.data()[a.pitch()[0] + 2] == 5.0f);
+    }
+
+    TEST_CASE("Tensor - map leaves padding untouched")
+    {
+        for (int64_t width : { 1, 7, 8, 16, 37, 100 })
+        {
+            auto shape = symd::Dimensions({ 5, width });
+
+            symd::Tensor<float> input(shape);
+            symd::Tensor<float> output(shape);
+
+            for (int64_t y = 0; y < shape[0]; y++)
+                for (int64_t x = 0; x < width; x++)
+                    input[symd::Dimensions({ y, x })] = (float)(y * 1000 + x);
+
+            symd::map_single_core(output, [](auto x) { return x * 2.0f + 1.0f; }, input);
+
+            for (int64_t y = 0; y < shape[0]; y++)
+            {
+                for (int64_t x = 0; x < width; x++)
+                    REQUIRE(output[symd::Dimensions({ y, x })] == (float)(y * 1000 + x) * 2.0f + 1.0f);
+
+                for (int64_t x = width; x < output.pitch()[0]; x++)
+                    REQUIRE(output.data()[y * output.pitch()[0] + x] == 0.0f);
+            }
+        }
+    }
+
+    TEST_CASE("Tensor - map with other views and types")
+    {
+        auto shape = symd::Dimensions({ 3, 2, 29 });
+
+        symd::Tensor<int> input(shape);
+        symd::Tensor<double> output(shape);
+        std::vector<int> other(shape.num_elements());
+
+        for (int64_t i = 0; i < shape.num_elements(); i++)
+        {
+            input[symd::Dimensions({ i / 58, (i / 29) % 2, i % 29 })] = (int)i;
+            other[i] = (int)i * 3;
+        }
+
+        auto otherView = symd::views::data_view<int, 3>(other.data(), shape, shape.native_pitch());
+
+        // Mixed with data_view, so only tensor rows are aligned
+        symd::map_single_core(output, [](auto x, auto y)
+            {
+                return symd::kernel::convert_to<double>(x + y) * 0.5;
+            }, input, otherView);
+
+        for (int64_t i = 0; i < shape.num_elements(); i++)
+            REQUIRE(output[symd::Dimensions({ i / 58, (i / 29) % 2, i % 29 })] == (double)(i * 4) * 0.5);
+    }
+
+    TEST_CASE("Tensor - multi threaded map and unsigned char")
+    {
+        auto shape = symd::Dimensions({ 500, 1001 });
+
+        symd::Tensor<unsigned char> input1(shape);
+        symd::Tensor<unsigned char> input2(shape);
+        symd::Tensor<unsigned char> output(shape);
+
+        for (int64_t y = 0; y < shape[0]; y++)
+            for (int64_t x = 0; x < shape[1]; x++)
+            {
+                input1[symd::Dimensions({ y, x })] = (unsigned char)(y + x * 3);
+                input2[symd::Dimensions({ y, x })] = (unsigned char)(y * 7 + x);
+            }
+
+        symd::map(output, [](auto x, auto y) { return symd::kernel::avg(x, y); }, input1, input2);
+
+        for (int64_t y = 0; y < shape[0]; y++)
+            for (int64_t x = 0; x < shape[1]; x++)
+            {
+                auto c = symd::Dimensions({ y, x });
+                REQUIRE(output[c] == (input1[c] + input2[c] + 1) / 2);
+            }
+    }
+
+    TEST_CASE("Tensor - aligned vs unaligned map speed")
+    {
+        auto shape = symd::Dimensions({ 1080, 1917 });
+
+        symd::Tensor<float> input(shape);
+        symd::Tensor<float> output(shape);
+
+        // Vector data offset by one element, so rows are not aligned
+        std::vector<float> inputVec(shape.num_elements() + 1);
+        std::vector<float> outputVec(shape.num_elements() + 1);
+
+        auto inView = symd::views::data_view<float, 2>(inputVec.data() + 1, shape, shape.native_pitch());
+        auto outView = symd::views::data_view<float, 2>(outputVec.data() + 1, shape, shape.native_pitch());
+
+        auto kernel = [](auto x) { return x * 0.5f + 3.0f; };
+
+        auto durationTensor = helpers::measure_execution_time_ms([&]()
+            {
+                symd::map_single_core(output, kernel, input);
+            });
+
+        auto durationUnaligned = helpers::measure_execution_time_ms([&]()
+            {
+                symd::map_single_core(outView, kernel, inView);
+            });
+
+        REQUIRE(output[symd::Dimensions({ 5, 5 })] == 3.0f);
+        REQUIRE(outputVec[7] == 3.0f);
+
+        std::cout << "Map (Tensor, aligned rows)     : " << durationTensor.count() << " ms" << std::endl;
+        std::cout << "Map (data_view, unaligned rows) : " << durationUnaligned.count() << " ms" << std::endl;
+    }
+}
@@ -3,6 +3,8 @@
 #include <chrono>
 #include <algorithm>
 #include <random>
+#include <numeric>
+#include <limits>
 
 // #define SYMD_USE_TBB 1
 #include "../LibSymd/symd.h"
@@ -151,10 +153,41 @@ namespace tests::helpers
     }
 
 
+    /// <summary>
+    /// Error of value in units in the last place of T, relative to reference computed in higher precision.
+    /// </summary>
+    template <typename T>
+    static double ulp_error(T value, long double reference)
+    {
+        T ref = std::abs((T)reference);
+        T ulp = std::nextafter(ref, std::numeric_limits<T>::infinity()) - ref;
+
+        return (double)(std::abs((long double)value - reference) / ulp);
+    }
+
+
+    /// <summary>
+    /// Repeats test data until it fills whole register, so same test data works for any SYMD_LEN.
+    /// </summary>
+    template <typename T>
+    static std::vector<T> repeat_to_symd_len(const std::vector<T>& in)
+    {
+        std::vector<T> res(std::max(in.size(), (size_t)SYMD_LEN));
+
+        for (size_t i = 0; i < res.size(); i++)
+            res[i] = in[i % in.size()];
+
+        return res;
+    }
+
+
     template <typename T, typename Operation>
-    static void check_binary_op_result(const std::vector<T>& in1, Operation&& op, const std::vector<T>& in2)
+    static void check_binary_op_result(const std::vector<T>& inData1, Operation&& op, const std::vector<T>& inData2)
     {
-        REQUIRE(in1.size() == in2.size());
+        REQUIRE(inData1.size() == inData2.size());
+
+        auto in1 = repeat_to_symd_len(inData1);
+        auto in2 = repeat_to_symd_len(inData2);
 
         SymdRegister<T> reg1(in1.data());
         SymdRegister<T> reg2(in2.data());
@@ -173,8 +206,9 @@ namespace tests::helpers
 
 
     template <typename T, typename Operation>
-    static void check_unary_op_result(Operation&& op, const std::vector<T>& in)
+    static void check_unary_op_result(Operation&& op, const std::vector<T>& inData)
     {
+        auto in = repeat_to_symd_len(inData);
         SymdRegister<T> reg(in.data());
         require_equal(reg, in);
 
@@ -189,9 +223,12 @@ namespace tests::helpers
 
 
     template <typename T, typename Operation>
-    static void check_cmp_op_result(const std::vector<T>& in1, Operation&& op, const std::vector<T>& in2)
+    static void check_cmp_op_result(const std::vector<T>& inData1, Operation&& op, const std::vector<T>& inData2)
     {
-        REQUIRE(in1.size() == in2.size());
+        REQUIRE(inData1.size() == inData2.size());
+
+        auto in1 = repeat_to_symd_len(inData1);
+        auto in2 = repeat_to_symd_len(inData2);
 
         SymdRegister<T> reg1(in1.data());
         SymdRegister<T> reg2(in2.data());
@@ -236,13 +273,13 @@ namespace tests::helpers
             // INTS
             else if constexpr (std::is_integral_v<T>)
             {
-                if (reference[i] && reg[i] != -1)
+                if (reference[i] && reg[i] != (T)-1)
                     valid = false;
                 else if (!reference[i] && reg[i] != 0)
                     valid = false;
 
                 // Check store as well
-                if (reference[i] && tmpRes[i + 1] != -1)
+                if (reference[i] && tmpRes[i + 1] != (T)-1)
                     valid = false;
                 else if (!reference[i] && tmpRes[i + 1] != 0)
                     valid = false;